@@ -1,9 +1,5 @@
-#include <stdio.h>
 #include <stdlib.h>
-#include <unistd.h>
-#include <sys/wait.h>
-#include <string.h>
-#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_bench.h"
 
 /**
  * PURPOSE:
@@ -12,11 +8,78 @@
  *   (CPU-intensive, Memory-intensive, or I/O-intensive).
  * 
  * USAGE:
- *   ./progA <worker_type> <num_processes>
+ *   ./progA <worker_type> <num_processes> [options]
  *   
  *   Parameters:
- *   - worker_type: Type of workload ("cpu", "mem", or "io")
+ *   - worker_type: Type of workload ("cpu", "mem", "io", "bsp", "imbalance",
+ *                  "atomic", "signal", "fdchurn", "cow", "idle" or a plugin
+ *                  worker)
  *   - num_processes: Number of child processes to create (1-100)
+ *
+ *   Options:
+ *   - --mem-fraction=F: Memory-pressure mode (mem only). The N children
+ *                       together allocate F * MemTotal (F may exceed 1.0
+ *                       inside a memory.max cgroup) and the parent reports
+ *                       major faults, swap traffic, memory PSI and throughput
+ *   - --mem-passes=P:   Number of sweeps over the array (default 1000)
+ *   - --io-mode=M:      I/O file strategy (io only): "truncate" reopens with
+ *                       fopen("w") every pass (default), "prealloc" opens
+ *                       once, fallocate()s and overwrites in place. Each
+ *                       worker prints an IO_STATS line with per-phase times
+ *   - --target-seconds=S: Calibrate the work size so one worker runs for
+ *                       about S seconds (probes the kernel first; the
+ *                       calibrated count is printed on a CALIBRATION line)
+ *   - --worker-lib=PATH: Load a worker plugin (shared object exporting
+ *                       pa01_worker_ops, see worker_api.h); its name becomes
+ *                       a valid worker_type. May be given more than once
+ *   - --units=U:        run_unit() calls per plugin worker (default 1000)
+ *   - --worker-arg=S:   Free-form argument passed to plugin workers
+ *   - --kernel=V:       Run cpu/mem with a templated kernel variant
+ *                       (e.g. cpu_f32_u4, mem_i64_s64_u4; see kernels.cpp)
+ *   - --barrier=B:      bsp barrier: pthread (default), sense, dissem, futex
+ *   - --supersteps=S:   bsp supersteps, compute slice + barrier (default 1000)
+ *   - --bsp-slice=T:    Leibniz terms per bsp compute slice (default 100000)
+ *   - --dist=D:         imbalance task costs: uniform (default), exp, pareto
+ *   - --schedule=P[,C]: imbalance task distribution: static (default),
+ *                       dynamic or guided, with chunk size C
+ *   - --tasks=T, --task-cost=C, --task-kernel=cpu|mem, --rounds=R:
+ *                       imbalance task set (defaults 1000, 20000, cpu, 10)
+ *   - --atomic-op=O:    atomic operation: load, store, add (default), cas
+ *   - --order=M:        atomic memory order: relaxed, acqrel, seqcst (default)
+ *   - --location=L:     atomic word: shared (default) or private per worker
+ *   - --batches=B, --batch-ops=K: atomic batches of K operations
+ *                       (defaults 1000, 100000)
+ *   - --sig-send=S:     signal send call: kill (processes) or tgkill
+ *   - --sig-recv=R:     signal consumption: handler (default), sigwaitinfo,
+ *                       signalfd
+ *   - --sig-pattern=P, --signals=R: ping (one worker at a time, default) or
+ *                       broadcast; R signals per worker (default 1000)
+ *   - --fd-kind=K:      fdchurn descriptors: file, pipe, eventfd, mix (default)
+ *   - --fd-batches=B, --fd-batch=C: fdchurn batches of C open/dup/close
+ *                       cycles (defaults 1000, 1000)
+ *   - --dataset-mb=M, --cow-write=F: cow table built before the workers
+ *                       start (default 256 MB) and the fraction of its pages
+ *                       each worker modifies (default 0, read only)
+ *   - --cow-batches=B, --cow-lookups=L: cow batches of L random table reads
+ *                       (defaults 100, 1000000)
+ *   - --latency-probe=US: Run a wakeup latency probe thread next to the
+ *                       workers (clock_nanosleep every US microseconds) and
+ *                       print a LATENCY_RESULT line (min/avg/p50/p99/max)
+ *   - --probe-policy=P, --probe-priority=R, --probe-cpu=C: probe scheduling:
+ *                       other (default), fifo, rr, batch, idle; priority for
+ *                       fifo/rr (default 80); CPU to pin it to
+ *   - --latency-hist=PATH: Write the probe histogram (1 us buckets) as CSV
+ *   - --smaps:          Read every process's smaps_rollup at the workers'
+ *                       peak and print SMAPS and MEM_RESULT lines (RSS, PSS,
+ *                       USS in total and per worker)
+ *   - --kmem:           Snapshot PageTables/KernelStack/Slab (and slabinfo)
+ *                       before the workers start and once all exist; print
+ *                       KMEM_RESULT with the kernel memory per worker
+ *   - --idle-ms=MS, --idle-sleeps=S: idle worker sleeps (defaults 100, 1)
+ *   - --quiet:          No startup banner or per-worker started/completed lines
+ *   - --startup:        Print a STARTUP line with CLOCK_MONOTONIC stamps of
+ *                       main() entry, the backend start and the first worker
+ *                       start (read by ./startup)
  * 
  * 
  * KEY FEATURES:
@@ -34,119 +97,13 @@
 
 /**
  * main() - Entry point for process-based benchmark program
- * 
+ *
  * WHAT IT DOES:
- *   1. Parses and validates command-line arguments
- *   2. Creates N child processes using fork()
- *   3. Each child executes the specified worker function
- *   4. Parent process waits for all children to complete
- *   5. Prints timing and status information
- * 
- * 
- * PROCESS FLOW:
- *   - Validate: Check arguments, worker type, and process count
- *   - Fork: Create N child processes in a loop
- *   - Execute: Each child runs the appropriate worker function
- *   - Synchronize: Parent waits for all children using waitpid()
- * 
+ *   Runs the shared benchmark core (bench_main() in libpa01bench.a) with
+ *   the fork() backend: one child process per worker.
+ *   Option parsing, calibration, timing and metrics are identical in progA
+ *   and progB; only the backend differs (see MT25081_Part_B_backends.c).
  */
 int main(int argc, char *argv[]) {
-    // Input validation: Check for correct number of arguments
-    if (argc != 3) {
-        fprintf(stderr, "Usage: %s <worker_type> <num_processes>\n", argv[0]);
-        fprintf(stderr, "worker_type: cpu, mem, or io\n");
-        fprintf(stderr, "num_processes: number of processes to create\n");
-        exit(EXIT_FAILURE);
-    }
-    
-    // Parse command-line arguments
-    char *worker_type = argv[1];
-    int num_processes = atoi(argv[2]);
-    
-    // Validate process count (reasonable bounds to prevent system overload)
-    if (num_processes < 1 || num_processes > 100) {
-        fprintf(stderr, "Error: num_processes must be between 1 and 100\n");
-        exit(EXIT_FAILURE);
-    }
-    
-    // Validate worker type (must be one of the three supported types)
-    if (strcmp(worker_type, "cpu") != 0 && 
-        strcmp(worker_type, "mem") != 0 && 
-        strcmp(worker_type, "io") != 0) {
-        fprintf(stderr, "Error: worker_type must be 'cpu', 'mem', or 'io'\n");
-        exit(EXIT_FAILURE);
-    }
-    
-    printf("[progA] Starting %d processes with worker type: %s\n", num_processes, worker_type);
-    fflush(stdout);
-    
-    // Array to store child process IDs for later synchronization
-    pid_t pids[num_processes];
-    
-    // FORK PHASE: Create N child processes
-    // Each child will execute one of the worker functions independently
-    for (int i = 0; i < num_processes; i++) {
-        pid_t pid = fork();
-        
-        if (pid < 0) {
-            // Fork failed - critical error, cannot continue
-            perror("fork");
-            exit(EXIT_FAILURE);
-        } else if (pid == 0) {
-            // CHILD PROCESS EXECUTION
-            // This code runs in the context of a new child process
-            printf("[progA] Child process %d (PID: %d) started\n", i + 1, getpid());
-            fflush(stdout);
-            
-            // Execute the appropriate worker function based on worker_type
-            // Each worker performs different type of workload for LOOP_COUNT iterations
-            if (strcmp(worker_type, "cpu") == 0) {
-                cpu_worker();  // CPU-intensive: Mathematical calculations
-            } else if (strcmp(worker_type, "mem") == 0) {
-                mem_worker();  // Memory-intensive: Large array allocation and access
-            } else if (strcmp(worker_type, "io") == 0) {
-                io_worker();   // I/O-intensive: Repeated file operations
-            }
-            
-            printf("[progA] Child process %d (PID: %d) completed\n", i + 1, getpid());
-            fflush(stdout);
-            exit(EXIT_SUCCESS);  // Child process terminates here
-        } else {
-            // PARENT PROCESS EXECUTION
-            // Store the child's PID for later synchronization
-            pids[i] = pid;
-        }
-    }
-    
-    // SYNCHRONIZATION PHASE: Parent waits for all children to complete
-    printf("[progA] Parent waiting for %d children to finish...\n", num_processes);
-    fflush(stdout);
-    
-    
-    // SYNCHRONIZATION: Wait for all children to finish
-    // waitpid() blocks until the specified child process terminates
-    int completed = 0;
-    for (int i = 0; i < num_processes; i++) {
-        int status;
-        pid_t wpid = waitpid(pids[i], &status, 0);
-        
-        if (wpid < 0) {
-            perror("waitpid");
-        } else {
-            completed++;
-            if (WIFEXITED(status)) {
-                // Child exited normally - check exit status
-                printf("[progA] Child %d exited with status: %d\n", i + 1, WEXITSTATUS(status));
-            } else {
-                // Child terminated abnormally (signal, etc.)
-                printf("[progA] Child %d terminated abnormally\n", i + 1);
-            }
-        }
-    }
-    
-    // All children have completed - program is done
-    printf("[progA] All %d children completed. Parent exiting.\n", completed);
-    fflush(stdout);
-    
-    return EXIT_SUCCESS;
+    return bench_main(argc, argv, &fork_backend);
 }
@@ -1,9 +1,5 @@
-#include <stdio.h>
 #include <stdlib.h>
-#include <pthread.h>
-#include <string.h>
-#include <unistd.h>
-#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_bench.h"
 
 /**
  * PURPOSE:
@@ -12,11 +8,78 @@
  *   (CPU-intensive, Memory-intensive, or I/O-intensive).
  * 
  * USAGE:
- *   ./progB <worker_type> <num_threads>
+ *   ./progB <worker_type> <num_threads> [options]
  *   
  *   Parameters:
- *   - worker_type: Type of workload ("cpu", "mem", or "io")
+ *   - worker_type: Type of workload ("cpu", "mem", "io", "bsp", "imbalance",
+ *                  "atomic", "signal", "fdchurn", "cow", "idle" or a plugin
+ *                  worker)
  *   - num_threads: Number of threads to create (1-100)
+ *
+ *   Options:
+ *   - --mem-fraction=F: Memory-pressure mode (mem only). The N threads
+ *                       together allocate F * MemTotal (F may exceed 1.0
+ *                       inside a memory.max cgroup) and main reports
+ *                       major faults, swap traffic, memory PSI and throughput
+ *   - --mem-passes=P:   Number of sweeps over the array (default 1000)
+ *   - --io-mode=M:      I/O file strategy (io only): "truncate" reopens with
+ *                       fopen("w") every pass (default), "prealloc" opens
+ *                       once, fallocate()s and overwrites in place. Each
+ *                       worker prints an IO_STATS line with per-phase times
+ *   - --target-seconds=S: Calibrate the work size so one worker runs for
+ *                       about S seconds (probes the kernel first; the
+ *                       calibrated count is printed on a CALIBRATION line)
+ *   - --worker-lib=PATH: Load a worker plugin (shared object exporting
+ *                       pa01_worker_ops, see worker_api.h); its name becomes
+ *                       a valid worker_type. May be given more than once
+ *   - --units=U:        run_unit() calls per plugin worker (default 1000)
+ *   - --worker-arg=S:   Free-form argument passed to plugin workers
+ *   - --kernel=V:       Run cpu/mem with a templated kernel variant
+ *                       (e.g. cpu_f32_u4, mem_i64_s64_u4; see kernels.cpp)
+ *   - --barrier=B:      bsp barrier: pthread (default), sense, dissem, futex
+ *   - --supersteps=S:   bsp supersteps, compute slice + barrier (default 1000)
+ *   - --bsp-slice=T:    Leibniz terms per bsp compute slice (default 100000)
+ *   - --dist=D:         imbalance task costs: uniform (default), exp, pareto
+ *   - --schedule=P[,C]: imbalance task distribution: static (default),
+ *                       dynamic or guided, with chunk size C
+ *   - --tasks=T, --task-cost=C, --task-kernel=cpu|mem, --rounds=R:
+ *                       imbalance task set (defaults 1000, 20000, cpu, 10)
+ *   - --atomic-op=O:    atomic operation: load, store, add (default), cas
+ *   - --order=M:        atomic memory order: relaxed, acqrel, seqcst (default)
+ *   - --location=L:     atomic word: shared (default) or private per worker
+ *   - --batches=B, --batch-ops=K: atomic batches of K operations
+ *                       (defaults 1000, 100000)
+ *   - --sig-send=S:     signal send call: tgkill (default) or pthread_kill
+ *   - --sig-recv=R:     signal consumption: handler (default), sigwaitinfo,
+ *                       signalfd
+ *   - --sig-pattern=P, --signals=R: ping (one worker at a time, default) or
+ *                       broadcast; R signals per worker (default 1000)
+ *   - --fd-kind=K:      fdchurn descriptors: file, pipe, eventfd, mix (default)
+ *   - --fd-batches=B, --fd-batch=C: fdchurn batches of C open/dup/close
+ *                       cycles (defaults 1000, 1000)
+ *   - --dataset-mb=M, --cow-write=F: cow table built before the workers
+ *                       start (default 256 MB) and the fraction of its pages
+ *                       each worker modifies (default 0, read only)
+ *   - --cow-batches=B, --cow-lookups=L: cow batches of L random table reads
+ *                       (defaults 100, 1000000)
+ *   - --latency-probe=US: Run a wakeup latency probe thread next to the
+ *                       workers (clock_nanosleep every US microseconds) and
+ *                       print a LATENCY_RESULT line (min/avg/p50/p99/max)
+ *   - --probe-policy=P, --probe-priority=R, --probe-cpu=C: probe scheduling:
+ *                       other (default), fifo, rr, batch, idle; priority for
+ *                       fifo/rr (default 80); CPU to pin it to
+ *   - --latency-hist=PATH: Write the probe histogram (1 us buckets) as CSV
+ *   - --smaps:          Read every process's smaps_rollup at the workers'
+ *                       peak and print SMAPS and MEM_RESULT lines (RSS, PSS,
+ *                       USS in total and per worker)
+ *   - --kmem:           Snapshot PageTables/KernelStack/Slab (and slabinfo)
+ *                       before the workers start and once all exist; print
+ *                       KMEM_RESULT with the kernel memory per worker
+ *   - --idle-ms=MS, --idle-sleeps=S: idle worker sleeps (defaults 100, 1)
+ *   - --quiet:          No startup banner or per-worker started/completed lines
+ *   - --startup:        Print a STARTUP line with CLOCK_MONOTONIC stamps of
+ *                       main() entry, the backend start and the first worker
+ *                       start (read by ./startup)
  * 
  * EXAMPLES:
  *   ./progB cpu 2    # Create 2 threads, each doing CPU work
@@ -38,162 +101,15 @@
  * 
  */
 
-/**
- * Thread argument structure
- * Used to pass parameters to worker threads
- */
-typedef struct {
-    int thread_id;           // Thread identifier (1..N)
-    char *worker_type;       // Type of worker: "cpu", "mem", or "io"
-} thread_args_t;
-
-/**
- * thread_function() - Worker function executed by each thread
- * 
- * WHAT IT DOES:
- *   1. Receives thread arguments (ID and worker type)
- *   2. Prints thread start message with thread ID
- *   3. Executes the appropriate worker function based on type
- *   4. Prints thread completion message
- *   5. Cleans up and exits
- * 
- * 
- * WORKER TYPES:
- *   - "cpu": cpu_worker() - CPU-bound calculations
- *   - "mem": mem_worker() - Memory-intensive array operations
- *   - "io": io_worker() - I/O-intensive file operations
- * ============================================================================
- */
-void *thread_function(void *arg) {
-    // Extract thread arguments from void pointer
-    thread_args_t *args = (thread_args_t *)arg;
-    int thread_id = args->thread_id;
-    char *worker_type = args->worker_type;
-    
-    // Print thread startup message with unique thread ID
-    printf("[progB] Thread %d (TID: %lu) started\n", thread_id, pthread_self());
-    fflush(stdout);
-    
-    // Execute the appropriate worker function based on worker_type parameter
-    // All threads share memory, so this can be CPU/memory/I/O bound
-    if (strcmp(worker_type, "cpu") == 0) {
-        cpu_worker();      // CPU-intensive: Mathematical calculations
-    } else if (strcmp(worker_type, "mem") == 0) {
-        mem_worker();      // Memory-intensive: Large array allocation and access
-    } else if (strcmp(worker_type, "io") == 0) {
-        io_worker();       // I/O-intensive: Repeated file operations
-    }
-    
-    // Print thread completion message
-    printf("[progB] Thread %d (TID: %lu) completed\n", thread_id, pthread_self());
-    fflush(stdout);
-    
-    // Clean up allocated arguments
-    free(args);
-    
-    // Thread exits (allows main to pthread_join() on this thread)
-    pthread_exit(NULL);
-}
-
 /**
  * main() - Entry point for thread-based benchmark program
- * 
+ *
  * WHAT IT DOES:
- *   1. Parses and validates command-line arguments
- *   2. Creates N threads using pthread_create()
- *   3. Each thread executes the specified worker function
- *   4. Main thread waits for all threads using pthread_join()
- *   5. Prints final status
- 
- * 
- * THREAD CREATION STRATEGY:
- *   - Parent thread creates N worker threads
- *   - Each thread receives its own thread_args_t structure
- *   - All threads share the same process memory and resources
- * 
+ *   Runs the shared benchmark core (bench_main() in libpa01bench.a) with
+ *   the pthread backend: one thread per worker.
+ *   Option parsing, calibration, timing and metrics are identical in progA
+ *   and progB; only the backend differs (see MT25081_Part_B_backends.c).
  */
 int main(int argc, char *argv[]) {
-    // Input validation: Check for correct number of arguments
-    if (argc != 3) {
-        fprintf(stderr, "Usage: %s <worker_type> <num_threads>\n", argv[0]);
-        fprintf(stderr, "worker_type: cpu, mem, or io\n");
-        fprintf(stderr, "num_threads: number of threads to create\n");
-        exit(EXIT_FAILURE);
-    }
-    
-    // Parse command-line arguments
-    char *worker_type = argv[1];
-    int num_threads = atoi(argv[2]);
-    
-    // Validate thread count (reasonable bounds to prevent resource exhaustion)
-    if (num_threads < 1 || num_threads > 100) {
-        fprintf(stderr, "Error: num_threads must be between 1 and 100\n");
-        exit(EXIT_FAILURE);
-    }
-    
-    // Validate worker type (must be one of the three supported types)
-    if (strcmp(worker_type, "cpu") != 0 && 
-        strcmp(worker_type, "mem") != 0 && 
-        strcmp(worker_type, "io") != 0) {
-        fprintf(stderr, "Error: worker_type must be 'cpu', 'mem', or 'io'\n");
-        exit(EXIT_FAILURE);
-    }
-    
-    printf("[progB] Starting %d threads with worker type: %s\n", num_threads, worker_type);
-    fflush(stdout);
-    
-    // Array to store thread handles for later synchronization
-    pthread_t threads[num_threads];
-    int thread_status[num_threads];
-    
-    // THREAD CREATION PHASE
-    // Create N worker threads in a loop, each with its own arguments
-    for (int i = 0; i < num_threads; i++) {
-        // Allocate memory for thread arguments (each thread gets its own copy)
-        thread_args_t *args = (thread_args_t *)malloc(sizeof(thread_args_t));
-        if (args == NULL) {
-            fprintf(stderr, "Memory allocation failed for thread args\n");
-            exit(EXIT_FAILURE);
-        }
-        
-        // Initialize thread arguments
-        args->thread_id = i + 1;                    // Thread number (1..N)
-        args->worker_type = worker_type;            // Copy of worker type
-        
-        // Create a new thread that will execute thread_function()
-        // All threads share the same process memory space
-        thread_status[i] = pthread_create(&threads[i], NULL, thread_function, (void *)args);
-        
-        if (thread_status[i] != 0) {
-            fprintf(stderr, "Failed to create thread %d\n", i + 1);
-            exit(EXIT_FAILURE);
-        }
-    }
-    
-    // SYNCHRONIZATION PHASE
-    // Main thread waits for all worker threads to complete
-    printf("[progB] Main thread waiting for %d threads to finish...\n", num_threads);
-    fflush(stdout);
-    
-    // Join all threads (blocking wait for each thread to finish)
-    int completed = 0;
-    for (int i = 0; i < num_threads; i++) {
-        // pthread_join() blocks until the thread terminates
-        thread_status[i] = pthread_join(threads[i], NULL);
-        
-        if (thread_status[i] != 0) {
-            fprintf(stderr, "Failed to join thread %d\n", i + 1);
-        } else {
-            completed++;
-            printf("[progB] Thread %d joined successfully\n", i + 1);
-        }
-    }
-    
-    // All threads have completed - program is done
-    printf("[progB] All %d threads completed. Main thread exiting.\n", completed);
-    fflush(stdout);
-    
-    return EXIT_SUCCESS;
+    return bench_main(argc, argv, &pthread_backend);
 }
-
-
@@ -0,0 +1,39 @@
+#include <stdlib.h>
+#include "MT25081_Part_B_bench.h"
+
+/**
+ * PURPOSE:
+ *   Runs the Part B workloads as a hybrid of processes and threads, the
+ *   layout of pre-forking servers with a thread pool per process. The N
+ *   workers are spread over --procs=P child processes (default 2); each
+ *   child runs its share as POSIX threads.
+ *
+ * USAGE:
+ *   ./progH <worker_type> <num_threads> [--procs=P] [options]
+ *
+ *   Parameters and options are the same as progA's and progB's (see
+ *   MT25081_Part_A_Program_B.c). P is capped at N; with P = 1 progH is
+ *   progB in one child, with P = N it is progA. Signals can only be sent
+ *   with --sig-send=tgkill.
+ *
+ * EXAMPLES:
+ *   ./progH cpu 8 --procs=2                 # 2 processes x 4 threads
+ *   ./progH idle 64 --procs=8 --kmem        # Kernel memory per worker
+ *
+ * KEY FEATURES:
+ *   - Same workers, timing and output lines as progA/progB
+ *   - Worker ids are consecutive within a child, so per-process results
+ *     (--smaps) group naturally
+ * ============================================================================
+ */
+
+/**
+ * main() - Entry point for the hybrid benchmark program
+ *
+ * WHAT IT DOES:
+ *   Runs the shared benchmark core (bench_main() in libpa01bench.a) with
+ *   the hybrid backend (MT25081_Part_B_backends.c).
+ */
+int main(int argc, char *argv[]) {
+    return bench_main(argc, argv, &hybrid_backend);
+}
@@ -0,0 +1,42 @@
+#include <stdlib.h>
+#include "MT25081_Part_B_bench.h"
+
+/**
+ * PURPOSE:
+ *   Runs the Part B workloads with OpenMP instead of hand-rolled pthreads,
+ *   to measure what the OpenMP runtime (libgomp) costs next to progB.
+ *   Creates a team of N threads; the work units of all N workers form one
+ *   "#pragma omp parallel for schedule(runtime)" loop.
+ *
+ * USAGE:
+ *   ./progO <worker_type> <num_threads> [options]
+ *
+ *   Parameters and options are the same as progB's (see
+ *   MT25081_Part_A_Program_B.c). The OpenMP environment selects the
+ *   schedule and thread placement:
+ *   - OMP_SCHEDULE:  static (default), dynamic[,chunk], guided[,chunk]
+ *   - OMP_PROC_BIND: false, true, close, spread
+ *   - OMP_PLACES:    threads, cores, sockets or a CPU list
+ *
+ * EXAMPLES:
+ *   ./progO cpu 4                                    # Same split as progB
+ *   OMP_SCHEDULE=dynamic,4 ./progO mem 4             # Units self-scheduled
+ *   OMP_PROC_BIND=spread OMP_PLACES=cores ./progO cpu 8
+ *
+ * KEY FEATURES:
+ *   - Same workers, timing and output lines as progA/progB, so the Part C
+ *     and Part D scripts record it in the same CSV schema (Program=progO)
+ *   - Each thread prints the OpenMP place and CPU it runs on
+ * ============================================================================
+ */
+
+/**
+ * main() - Entry point for the OpenMP benchmark program
+ *
+ * WHAT IT DOES:
+ *   Runs the shared benchmark core (bench_main() in libpa01bench.a) with
+ *   the OpenMP backend (MT25081_Part_B_backend_omp.c).
+ */
+int main(int argc, char *argv[]) {
+    return bench_main(argc, argv, &omp_backend);
+}
@@ -0,0 +1,277 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_atomic.h"
+#include "MT25081_Part_B_timing.h"
+#include <sched.h>
+#include <sys/mman.h>
+
+/**
+ *
+ * atomic worker: cost of atomic operations per memory order (see atomic.h).
+ *
+ * The memory order of a GCC __atomic builtin must be a compile-time
+ * constant, otherwise the compiler falls back to seq_cst. atomic_batch()
+ * is therefore always inlined into one call per order, each passing
+ * literal __ATOMIC_* constants.
+ *
+ * The locations and result slots live in atomic_setup()'s shared mapping,
+ * so the worker needs it (--target-seconds is refused, as for bsp).
+ * ============================================================================
+ */
+
+static const char *const op_names[] = {"load", "store", "add", "cas"};
+static const char *const order_names[] = {"relaxed", "acqrel", "seqcst"};
+static const char *const loc_names[] = {"shared", "private"};
+
+/**
+ * name_index() - Position of name in a table, -1 if absent
+ */
+static int name_index(const char *name, const char *const *names, int count) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(name, names[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int atomic_op_parse(const char *name, atomic_op_t *op) {
+    int i = name_index(name, op_names, 4);
+    if (i < 0) {
+        return -1;
+    }
+    *op = (atomic_op_t)i;
+    return 0;
+}
+
+int atomic_order_parse(const char *name, atomic_order_t *order) {
+    int i = name_index(name, order_names, 3);
+    if (i < 0) {
+        return -1;
+    }
+    *order = (atomic_order_t)i;
+    return 0;
+}
+
+int atomic_loc_parse(const char *name, atomic_loc_t *loc) {
+    int i = name_index(name, loc_names, 2);
+    if (i < 0) {
+        return -1;
+    }
+    *loc = (atomic_loc_t)i;
+    return 0;
+}
+
+const char *atomic_op_name(atomic_op_t op) {
+    return op_names[op];
+}
+
+const char *atomic_order_name(atomic_order_t order) {
+    return order_names[order];
+}
+
+const char *atomic_loc_name(atomic_loc_t loc) {
+    return loc_names[loc];
+}
+
+int atomic_setup(work_params_t *work, int num_workers, const char *tag) {
+    atomic_shared_t *shared = mmap(NULL, sizeof(atomic_shared_t), PROT_READ | PROT_WRITE,
+                                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+    shared->barrier = barrier_create(BARRIER_FUTEX, num_workers);
+    if (shared->barrier == NULL) {
+        munmap(shared, sizeof(atomic_shared_t));
+        return -1;
+    }
+    shared->parties = num_workers;
+    work->atomic = shared;
+    printf("[%s] ATOMIC op=%s order=%s location=%s batches=%d batch_ops=%d\n",
+           tag, atomic_op_name(work->atomic_op), atomic_order_name(work->atomic_order),
+           atomic_loc_name(work->atomic_loc), work->atomic_batches, work->atomic_batch_ops);
+    return 0;
+}
+
+void atomic_cleanup(work_params_t *work, const char *tag) {
+    (void)tag;
+    if (work->atomic != NULL) {
+        barrier_free(work->atomic->barrier);
+        munmap(work->atomic, sizeof(atomic_shared_t));
+        work->atomic = NULL;
+    }
+}
+
+/**
+ * Per-worker state
+ */
+typedef struct {
+    atomic_shared_t *shared;     // atomic_setup()'s state
+    barrier_local_t local;
+    long *word;                  // Location the batches operate on
+    int id;                      // 0..parties-1
+    atomic_slot_t totals;
+} atomic_state_t;
+
+static int atomic_init(worker_ctx_t *ctx) {
+    atomic_shared_t *shared = ctx->work->atomic;
+    if (shared == NULL || ctx->worker_id < 1 || ctx->worker_id > shared->parties) {
+        fprintf(stderr, "atomic worker %d: no shared state (atomic_setup() not run)\n",
+                ctx->worker_id);
+        return -1;
+    }
+    atomic_state_t *at = (atomic_state_t *)calloc(1, sizeof(atomic_state_t));
+    if (at == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    at->shared = shared;
+    at->id = ctx->worker_id - 1;
+    barrier_local_init(&at->local, at->id);
+    at->word = ctx->work->atomic_loc == ATOMIC_LOC_SHARED ? &shared->word
+                                                          : &shared->slots[at->id].word;
+    ctx->state = at;
+    return 0;
+}
+
+/**
+ * atomic_batch() - ops operations of one kind; LOAD_ORDER, STORE_ORDER and
+ * RMW_ORDER are the constants for loads, stores and read-modify-writes
+ */
+static inline __attribute__((always_inline)) long long
+atomic_batch(long *word, atomic_op_t op, long ops, int load_order, int store_order,
+             int rmw_order) {
+    long long fails = 0;
+    long sink = 0;
+    switch (op) {
+    case ATOMIC_OP_LOAD:
+        for (long i = 0; i < ops; i++) {
+            sink += __atomic_load_n(word, load_order);
+        }
+        break;
+    case ATOMIC_OP_STORE:
+        for (long i = 0; i < ops; i++) {
+            __atomic_store_n(word, i, store_order);
+        }
+        break;
+    case ATOMIC_OP_ADD:
+        for (long i = 0; i < ops; i++) {
+            __atomic_fetch_add(word, 1, rmw_order);
+        }
+        break;
+    case ATOMIC_OP_CAS:
+        for (long i = 0; i < ops; i++) {
+            long cur = __atomic_load_n(word, __ATOMIC_RELAXED);
+            while (!__atomic_compare_exchange_n(word, &cur, cur + 1, 0, rmw_order,
+                                                __ATOMIC_RELAXED)) {
+                fails++;
+            }
+        }
+        break;
+    }
+    DO_NOT_OPTIMIZE(sink);
+    return fails;
+}
+
+static int atomic_run_unit(worker_ctx_t *ctx) {
+    atomic_state_t *at = (atomic_state_t *)ctx->state;
+    const work_params_t *work = ctx->work;
+    long ops = work->atomic_batch_ops;
+    long long fails;
+
+    uint64_t t0 = timing_now();
+    switch (work->atomic_order) {
+    case ATOMIC_ORDER_RELAXED:
+        fails = atomic_batch(at->word, work->atomic_op, ops,
+                             __ATOMIC_RELAXED, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        break;
+    case ATOMIC_ORDER_ACQREL:
+        fails = atomic_batch(at->word, work->atomic_op, ops,
+                             __ATOMIC_ACQUIRE, __ATOMIC_RELEASE, __ATOMIC_ACQ_REL);
+        break;
+    default:
+        fails = atomic_batch(at->word, work->atomic_op, ops,
+                             __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+        break;
+    }
+    uint64_t t1 = timing_now();
+
+    atomic_slot_t *totals = &at->totals;
+    if (totals->ops == 0) {
+        totals->first_tick = t0;
+    }
+    totals->last_tick = t1;
+    totals->ticks += t1 - t0;
+    totals->ops += ops;
+    totals->cas_fails += fails;
+    return 0;
+}
+
+static void atomic_teardown(worker_ctx_t *ctx) {
+    free(ctx->state);
+    ctx->state = NULL;
+}
+
+/**
+ * atomic_print_result() - Latency, throughput and lost updates over slots
+ */
+static void atomic_print_result(const char *tag, const atomic_shared_t *shared,
+                                const work_params_t *work) {
+    long long ops = 0, fails = 0;
+    uint64_t ticks = 0, first = UINT64_MAX, last = 0;
+    long value = shared->word;
+    for (int i = 0; i < shared->parties; i++) {
+        const atomic_slot_t *slot = &shared->slots[i];
+        ops += slot->ops;
+        fails += slot->cas_fails;
+        ticks += slot->ticks;
+        value += slot->word;
+        first = slot->first_tick < first ? slot->first_tick : first;
+        last = slot->last_tick > last ? slot->last_tick : last;
+    }
+
+    // Every add/cas incremented exactly one word by 1
+    int rmw = work->atomic_op == ATOMIC_OP_ADD || work->atomic_op == ATOMIC_OP_CAS;
+    long long lost = rmw ? ops - value : 0;
+    double wall_ns = last > first ? timing_ticks_to_ns(last - first) : 0.0;
+
+    cpu_set_t set;
+    int cpus = sched_getaffinity(0, sizeof(set), &set) == 0 ? CPU_COUNT(&set) : 1;
+
+    printf("[%s] ATOMIC_RESULT op=%s order=%s location=%s workers=%d cpus=%d ops=%lld "
+           "ns_per_op=%.3f mops=%.2f cas_fail_pct=%.2f lost_updates=%lld\n",
+           tag, atomic_op_name(work->atomic_op), atomic_order_name(work->atomic_order),
+           atomic_loc_name(work->atomic_loc), shared->parties, cpus, ops,
+           ops ? timing_ticks_to_ns(ticks) / ops : 0.0,
+           wall_ns > 0.0 ? ops * 1e3 / wall_ns : 0.0,
+           ops ? 100.0 * fails / (ops + fails) : 0.0, lost);
+    fflush(stdout);
+}
+
+static void atomic_report(const worker_ctx_t *ctx) {
+    atomic_state_t *at = (atomic_state_t *)ctx->state;
+    const atomic_slot_t *totals = &at->totals;
+    printf("[%s] ATOMIC_STATS worker=%d batches=%d ops=%lld ns_per_op=%.3f cas_fails=%lld\n",
+           ctx->tag, ctx->worker_id, ctx->stats.units, totals->ops,
+           totals->ops ? timing_ticks_to_ns(totals->ticks) / totals->ops : 0.0,
+           totals->cas_fails);
+    fflush(stdout);
+
+    // Publish (the slot's word is this worker's location and stays), then
+    // one more barrier so worker 1 reads complete slots
+    atomic_slot_t *slot = &at->shared->slots[at->id];
+    slot->ops = totals->ops;
+    slot->cas_fails = totals->cas_fails;
+    slot->ticks = totals->ticks;
+    slot->first_tick = totals->first_tick;
+    slot->last_tick = totals->last_tick;
+    barrier_wait(at->shared->barrier, &at->local);
+    if (at->id == 0) {
+        atomic_print_result(ctx->tag, at->shared, ctx->work);
+    }
+}
+
+const worker_ops_t atomic_worker_ops = {
+    WORKER_API_VERSION, "atomic", "one batch of atomic operations",
+    atomic_init, atomic_run_unit, atomic_teardown, atomic_report
+};
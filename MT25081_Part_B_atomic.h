@@ -0,0 +1,82 @@
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_barrier.h"
+
+/**
+ * Atomic memory-ordering worker.
+ *
+ * One unit is a batch of work->atomic_batch_ops atomic operations of one
+ * kind (work->atomic_op) under one memory order (work->atomic_order) on one
+ * location (work->atomic_loc):
+ *
+ *   load   - __atomic_load_n               relaxed | acquire | seq_cst
+ *   store  - __atomic_store_n              relaxed | release | seq_cst
+ *   add    - __atomic_fetch_add(+1)        relaxed | acq_rel | seq_cst
+ *   cas    - load + compare_exchange(+1),  relaxed | acq_rel | seq_cst
+ *            retried until it succeeds (failures counted)
+ *
+ *   shared  - one word that all N workers hit (one contended cache line)
+ *   private - one word per worker, each on its own cache line
+ *
+ * Both locations live in MAP_SHARED memory, so progA's processes contend on
+ * the same cache line as progB's threads. After the last batch worker 1
+ * prints a "[tag] ATOMIC_RESULT ..." line: ns_per_op (mean latency of one
+ * operation in one worker), mops (all workers' operations per second of
+ * wall time) and, for add/cas, lost_updates (must be 0).
+ */
+
+/**
+ * Per-worker location and totals, one cache line each
+ */
+typedef struct {
+    long word;               // This worker's private location
+    long long ops;           // Operations completed
+    long long cas_fails;     // Failed compare_exchange attempts
+    uint64_t ticks;          // Time in batches
+    uint64_t first_tick;     // Start of the first batch
+    uint64_t last_tick;      // End of the last batch
+} __attribute__((aligned(64))) atomic_slot_t;
+
+/**
+ * State shared by all workers of a run (MAP_SHARED, created before fork)
+ */
+typedef struct atomic_shared {
+    barrier_t *barrier;                      // Result barrier
+    int parties;                             // Number of workers
+    long word __attribute__((aligned(64)));  // The shared location
+    atomic_slot_t slots[BARRIER_MAX_PARTIES]; // Indexed by worker_id - 1
+} atomic_shared_t;
+
+/**
+ * Parse "load|store|add|cas", "relaxed|acqrel|seqcst" and "shared|private";
+ * return -1 if unknown
+ */
+int atomic_op_parse(const char *name, atomic_op_t *op);
+int atomic_order_parse(const char *name, atomic_order_t *order);
+int atomic_loc_parse(const char *name, atomic_loc_t *loc);
+
+/**
+ * Names for the startup and result lines
+ */
+const char *atomic_op_name(atomic_op_t op);
+const char *atomic_order_name(atomic_order_t order);
+const char *atomic_loc_name(atomic_loc_t loc);
+
+/**
+ * Setup hook: maps the locations, barrier and result slots for num_workers
+ * workers, stores them in work->atomic and prints the "[tag] ATOMIC" line.
+ * Must run before the workers start.
+ * Returns -1 (reason on stderr) on failure.
+ */
+int atomic_setup(work_params_t *work, int num_workers, const char *tag);
+
+/**
+ * Cleanup hook: unmaps the shared state from atomic_setup()
+ */
+void atomic_cleanup(work_params_t *work, const char *tag);
+
+extern const worker_ops_t atomic_worker_ops;
+
+#endif /* ATOMIC_H */
@@ -0,0 +1,154 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_bench.h"
+#include "MT25081_Part_B_memacct.h"
+#include "MT25081_Part_B_kmem.h"
+#include "MT25081_Part_B_timing.h"
+#include <sched.h>
+#include <sys/resource.h>
+#include <omp.h>
+
+/**
+ *
+ * OpenMP execution backend for bench_main() (progO).
+ *
+ * Compiled with -fopenmp and linked into progO only, so progA, progB and
+ * libpa01bench.a do not depend on libgomp.
+ *
+ * Unlike the fork and pthread backends, progO does not run one whole
+ * worker per thread. Each of the N threads still owns a worker context
+ * (init, report, teardown), but the N * units work units of the run are one
+ * "#pragma omp parallel for schedule(runtime)" loop, so the OpenMP runtime
+ * decides which thread runs which unit:
+ *
+ *   OMP_SCHEDULE   static (default here), dynamic[,chunk], guided[,chunk]
+ *   OMP_PROC_BIND  false, true, close, spread, master/primary
+ *   OMP_PLACES     threads, cores, sockets, or an explicit CPU list
+ *
+ * With a static schedule every thread runs exactly its own worker's units,
+ * i.e. the same work split as progB.
+ * ============================================================================
+ */
+
+/**
+ * schedule_kind_name() - Name of an omp_sched_t, as OMP_SCHEDULE spells it
+ */
+static const char *schedule_kind_name(omp_sched_t kind) {
+    switch ((int)kind & ~(int)omp_sched_monotonic) {
+    case omp_sched_static:
+        return "static";
+    case omp_sched_dynamic:
+        return "dynamic";
+    case omp_sched_guided:
+        return "guided";
+    default:
+        return "auto";
+    }
+}
+
+/**
+ * proc_bind_name() - Name of the thread affinity policy in effect
+ */
+static const char *proc_bind_name(omp_proc_bind_t bind) {
+    switch (bind) {
+    case omp_proc_bind_false:
+        return "false";
+    case omp_proc_bind_true:
+        return "true";
+    case omp_proc_bind_master:
+        return "master";
+    case omp_proc_bind_close:
+        return "close";
+    case omp_proc_bind_spread:
+        return "spread";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ * omp_run() - One OpenMP team of N threads sharing one parallel loop of units
+ */
+static int omp_run(const bench_backend_t *self, const bench_config_t *cfg) {
+    const char *tag = self->tag;
+    const worker_ops_t *ops = cfg->ops;
+    int n = cfg->num_workers;
+    worker_ctx_t ctx[BENCH_MAX_WORKERS];
+
+    // SCHEDULE: OMP_SCHEDULE if set, otherwise the same static split as progB
+    if (getenv("OMP_SCHEDULE") == NULL) {
+        omp_set_schedule(omp_sched_static, 0);
+    }
+    omp_sched_t kind;
+    int chunk;
+    omp_get_schedule(&kind, &chunk);
+
+    // WORKER_OWN_UNITS workers synchronize whole workers; every thread must
+    // run exactly its own units or the barriers/signals never match up
+    if (worker_owns_units(ops) &&
+        ((int)kind & ~(int)omp_sched_monotonic) != omp_sched_static) {
+        fprintf(stderr, "Error: worker '%s' needs OMP_SCHEDULE=static in %s\n", ops->name, tag);
+        exit(EXIT_FAILURE);
+    }
+
+    if (!cfg->quiet) {
+        printf("[%s] OpenMP schedule=%s chunk=%d proc_bind=%s places=%d\n",
+               tag, schedule_kind_name(kind), chunk, proc_bind_name(omp_get_proc_bind()),
+               omp_get_num_places());
+        fflush(stdout);
+    }
+
+    int completed = 0;
+#pragma omp parallel num_threads(n) reduction(+ : completed)
+    {
+        int id = omp_get_thread_num();
+        int threads = omp_get_num_threads();
+        worker_ctx_t *c = &ctx[id];
+        worker_ctx_init(c, ops, tag, id + 1, &cfg->work);
+
+        if (cfg->first_worker_ns != NULL) {
+            uint64_t unset = 0;
+            __atomic_compare_exchange_n(cfg->first_worker_ns, &unset, timing_monotonic_ns(), 0,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+        if (!cfg->quiet) {
+            printf("[%s] Thread %d (place %d, CPU %d) started\n",
+                   tag, id + 1, omp_get_place_num(), sched_getcpu());
+            fflush(stdout);
+        }
+
+        // A failed init skips its units but still reaches the loop, which
+        // every thread of the team must enter
+        int inited = ops->init == NULL || ops->init(c) == 0;
+        int rc = inited ? 0 : -1;
+        long total = (long)threads * c->units;
+        if (cfg->kmemacct != NULL) {
+            kmem_sample(cfg->kmemacct, id + 1);
+        }
+
+#pragma omp for schedule(runtime)
+        for (long u = 0; u < total; u++) {
+            if (rc == 0 && worker_unit(ops, c) != 0) {
+                rc = -1;
+            }
+        }
+
+        if (cfg->memacct != NULL) {
+            memacct_sample(cfg->memacct, id + 1);
+        }
+        if (inited) {
+            worker_finish(ops, c, rc);
+        }
+        if (!cfg->quiet) {
+            printf("[%s] Thread %d %s (%d units)\n", tag, id + 1,
+                   rc == 0 ? "completed" : "failed", c->stats.units);
+            fflush(stdout);
+        }
+        completed += rc == 0;
+    }
+    return completed;
+}
+
+const bench_backend_t omp_backend = {
+    "progO", "thread", "threads", "All %d OpenMP threads completed. Main thread exiting.",
+    omp_run, RUSAGE_SELF, WORKER_MODEL_THREADS
+};
@@ -0,0 +1,274 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_bench.h"
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+/**
+ *
+ * Execution backends for bench_main().
+ *
+ * A backend starts cfg->num_workers workers, each of which calls
+ * bench_worker_run(), and waits for them. Nothing else differs between
+ * progA, progB and progH, so every measurement is made by the same code.
+ * ============================================================================
+ */
+
+/* ========================= fork() backend (progA) ========================= */
+
+/**
+ * fork_run() - One child process per worker, collected with waitpid()
+ *
+ * Each process is independent with a separate (copy-on-write) address
+ * space; the child exits with the worker's status.
+ */
+static int fork_run(const bench_backend_t *self, const bench_config_t *cfg) {
+    const char *tag = self->tag;
+    int n = cfg->num_workers;
+    pid_t pids[BENCH_MAX_WORKERS];
+
+    // FORK PHASE: Create N child processes
+    for (int i = 0; i < n; i++) {
+        pid_t pid = fork();
+
+        if (pid < 0) {
+            // Fork failed - critical error, cannot continue
+            perror("fork");
+            exit(EXIT_FAILURE);
+        } else if (pid == 0) {
+            // CHILD PROCESS EXECUTION
+            if (!cfg->quiet) {
+                printf("[%s] Child process %d (PID: %d) started\n", tag, i + 1, getpid());
+                fflush(stdout);
+            }
+
+            if (bench_worker_run(cfg, tag, i + 1) != 0) {
+                exit(EXIT_FAILURE);
+            }
+
+            if (!cfg->quiet) {
+                printf("[%s] Child process %d (PID: %d) completed\n", tag, i + 1, getpid());
+                fflush(stdout);
+            }
+            exit(EXIT_SUCCESS);  // Child process terminates here
+        }
+        // PARENT PROCESS EXECUTION: store the child's PID for waitpid()
+        pids[i] = pid;
+    }
+
+    // SYNCHRONIZATION PHASE: Parent waits for all children to complete
+    if (!cfg->quiet) {
+        printf("[%s] Parent waiting for %d children to finish...\n", tag, n);
+        fflush(stdout);
+    }
+
+    int completed = 0;
+    for (int i = 0; i < n; i++) {
+        int status;
+        pid_t wpid = waitpid(pids[i], &status, 0);
+
+        if (wpid < 0) {
+            perror("waitpid");
+        } else {
+            completed++;
+            if (cfg->quiet) {
+                continue;
+            }
+            if (WIFEXITED(status)) {
+                // Child exited normally - check exit status
+                printf("[%s] Child %d exited with status: %d\n", tag, i + 1, WEXITSTATUS(status));
+            } else {
+                // Child terminated abnormally (signal, etc.)
+                printf("[%s] Child %d terminated abnormally\n", tag, i + 1);
+            }
+        }
+    }
+    return completed;
+}
+
+const bench_backend_t fork_backend = {
+    "progA", "process", "processes", "All %d children completed. Parent exiting.",
+    fork_run, RUSAGE_CHILDREN, WORKER_MODEL_PROCESSES
+};
+
+/* ======================= pthread backend (progB) ========================== */
+
+/**
+ * Thread argument structure
+ */
+typedef struct {
+    int thread_id;               // Thread identifier (1..N)
+    const char *tag;             // Output prefix of the backend
+    const bench_config_t *cfg;   // Shared, read-only run configuration
+} thread_args_t;
+
+/**
+ * thread_function() - Worker function executed by each thread
+ */
+static void *thread_function(void *arg) {
+    thread_args_t *args = (thread_args_t *)arg;
+
+    int quiet = args->cfg->quiet;
+    if (!quiet) {
+        printf("[%s] Thread %d (TID: %lu) started\n", args->tag, args->thread_id, pthread_self());
+        fflush(stdout);
+    }
+
+    bench_worker_run(args->cfg, args->tag, args->thread_id);
+
+    if (!quiet) {
+        printf("[%s] Thread %d (TID: %lu) completed\n", args->tag, args->thread_id, pthread_self());
+        fflush(stdout);
+    }
+    return NULL;
+}
+
+/**
+ * pthread_run() - One thread per worker, collected with pthread_join()
+ *
+ * All threads share the process's memory space, so the getrusage() fault
+ * counts after the join cover every worker (RUSAGE_SELF).
+ */
+static int pthread_run(const bench_backend_t *self, const bench_config_t *cfg) {
+    int n = cfg->num_workers;
+    pthread_t threads[BENCH_MAX_WORKERS];
+    thread_args_t args[BENCH_MAX_WORKERS];
+
+    // THREAD CREATION PHASE: each thread gets its own argument slot
+    for (int i = 0; i < n; i++) {
+        args[i].thread_id = i + 1;
+        args[i].tag = self->tag;
+        args[i].cfg = cfg;
+        if (pthread_create(&threads[i], NULL, thread_function, &args[i]) != 0) {
+            fprintf(stderr, "Failed to create thread %d\n", i + 1);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // SYNCHRONIZATION PHASE: Main thread waits for all worker threads
+    if (!cfg->quiet) {
+        printf("[%s] Main thread waiting for %d threads to finish...\n", self->tag, n);
+        fflush(stdout);
+    }
+
+    int completed = 0;
+    for (int i = 0; i < n; i++) {
+        if (pthread_join(threads[i], NULL) != 0) {
+            fprintf(stderr, "Failed to join thread %d\n", i + 1);
+        } else {
+            completed++;
+            if (!cfg->quiet) {
+                printf("[%s] Thread %d joined successfully\n", self->tag, i + 1);
+            }
+        }
+    }
+    return completed;
+}
+
+const bench_backend_t pthread_backend = {
+    "progB", "thread", "threads", "All %d threads completed. Main thread exiting.",
+    pthread_run, RUSAGE_SELF, WORKER_MODEL_THREADS
+};
+
+/* ==================== fork() + pthread backend (progH) ==================== */
+
+/**
+ * hybrid_child() - Runs workers first..first+count-1 as threads of this
+ * child process; returns how many of them were joined
+ */
+static int hybrid_child(const bench_backend_t *self, const bench_config_t *cfg,
+                        int first, int count) {
+    pthread_t threads[BENCH_MAX_WORKERS];
+    thread_args_t args[BENCH_MAX_WORKERS];
+
+    for (int i = 0; i < count; i++) {
+        args[i].thread_id = first + i;
+        args[i].tag = self->tag;
+        args[i].cfg = cfg;
+        if (pthread_create(&threads[i], NULL, thread_function, &args[i]) != 0) {
+            fprintf(stderr, "Failed to create thread %d\n", first + i);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    int joined = 0;
+    for (int i = 0; i < count; i++) {
+        if (pthread_join(threads[i], NULL) != 0) {
+            fprintf(stderr, "Failed to join thread %d\n", first + i);
+        } else {
+            joined++;
+        }
+    }
+    return joined;
+}
+
+/**
+ * hybrid_run() - cfg->procs child processes, each running its share of the
+ * N workers as threads
+ *
+ * Process p gets the consecutive worker ids p*N/P+1 .. (p+1)*N/P, so the
+ * split is as even as N and P allow. A child exits with the number of its
+ * threads that completed (at most BENCH_MAX_WORKERS, within an exit code).
+ */
+static int hybrid_run(const bench_backend_t *self, const bench_config_t *cfg) {
+    const char *tag = self->tag;
+    int n = cfg->num_workers;
+    int procs = cfg->procs;
+    pid_t pids[BENCH_MAX_WORKERS];
+
+    // FORK PHASE: Create P child processes
+    for (int p = 0; p < procs; p++) {
+        int first = p * n / procs + 1;
+        int count = (p + 1) * n / procs - (first - 1);
+        pid_t pid = fork();
+
+        if (pid < 0) {
+            perror("fork");
+            exit(EXIT_FAILURE);
+        } else if (pid == 0) {
+            // CHILD PROCESS EXECUTION: its threads, then exit with their count
+            if (!cfg->quiet) {
+                printf("[%s] Child process %d (PID: %d) started with threads %d-%d\n",
+                       tag, p + 1, getpid(), first, first + count - 1);
+                fflush(stdout);
+            }
+            int joined = hybrid_child(self, cfg, first, count);
+            if (!cfg->quiet) {
+                printf("[%s] Child process %d (PID: %d) completed\n", tag, p + 1, getpid());
+                fflush(stdout);
+            }
+            exit(joined);
+        }
+        pids[p] = pid;
+    }
+
+    // SYNCHRONIZATION PHASE: Parent waits for all children to complete
+    if (!cfg->quiet) {
+        printf("[%s] Parent waiting for %d children (%d threads) to finish...\n",
+               tag, procs, n);
+        fflush(stdout);
+    }
+
+    int completed = 0;
+    for (int p = 0; p < procs; p++) {
+        int status;
+        if (waitpid(pids[p], &status, 0) < 0) {
+            perror("waitpid");
+        } else if (WIFEXITED(status)) {
+            completed += WEXITSTATUS(status);
+            if (!cfg->quiet) {
+                printf("[%s] Child %d exited with %d threads completed\n",
+                       tag, p + 1, WEXITSTATUS(status));
+            }
+        } else {
+            printf("[%s] Child %d terminated abnormally\n", tag, p + 1);
+        }
+    }
+    return completed;
+}
+
+const bench_backend_t hybrid_backend = {
+    "progH", "thread", "threads", "All %d threads in all children completed. Parent exiting.",
+    hybrid_run, RUSAGE_CHILDREN, WORKER_MODEL_HYBRID
+};
@@ -0,0 +1,204 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_barrier.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <string.h>
+#include <limits.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/**
+ *
+ * Barrier implementations compared by the bsp worker (see barrier.h).
+ *
+ * Shared words are accessed with the GCC __atomic builtins: the releasing
+ * store (last arrival, or the partner's flag) is RELEASE and the waiters'
+ * polls are ACQUIRE, so everything written before a barrier is visible to
+ * every party after it.
+ * ============================================================================
+ */
+
+/**
+ * Dissemination flags of one worker, [parity][round], on their own line
+ */
+typedef struct {
+    int flag[2][BARRIER_MAX_ROUNDS];
+} __attribute__((aligned(64))) barrier_flags_t;
+
+/**
+ * Shared barrier state (must live in memory shared by all parties)
+ */
+struct barrier {
+    barrier_kind_t kind;
+    int parties;
+    int rounds;                                     // dissem: ceil(log2 parties)
+    pthread_barrier_t pthread;                      // BARRIER_PTHREAD
+    int count __attribute__((aligned(64)));         // SENSE / FUTEX arrivals
+    int sense __attribute__((aligned(64)));         // SENSE release flag
+    uint32_t generation __attribute__((aligned(64)));  // FUTEX wait word
+    barrier_flags_t flags[BARRIER_MAX_PARTIES];     // DISSEM
+};
+
+static const char *const kind_names[] = {"pthread", "sense", "dissem", "futex"};
+
+int barrier_kind_parse(const char *name, barrier_kind_t *kind) {
+    for (int k = 0; k < (int)(sizeof(kind_names) / sizeof(kind_names[0])); k++) {
+        if (strcmp(name, kind_names[k]) == 0) {
+            *kind = (barrier_kind_t)k;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *barrier_kind_name(barrier_kind_t kind) {
+    return kind_names[kind];
+}
+
+barrier_t *barrier_create(barrier_kind_t kind, int parties) {
+    if (parties < 1 || parties > BARRIER_MAX_PARTIES) {
+        fprintf(stderr, "Error: barrier supports 1..%d parties\n", BARRIER_MAX_PARTIES);
+        return NULL;
+    }
+    // Anonymous shared mapping: zero-filled and inherited across fork()
+    barrier_t *barrier = mmap(NULL, sizeof(barrier_t), PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (barrier == MAP_FAILED) {
+        perror("mmap");
+        return NULL;
+    }
+    barrier->kind = kind;
+    barrier->parties = parties;
+    while ((1 << barrier->rounds) < parties) {
+        barrier->rounds++;
+    }
+
+    if (kind == BARRIER_PTHREAD) {
+        pthread_barrierattr_t attr;
+        pthread_barrierattr_init(&attr);
+        pthread_barrierattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+        int rc = pthread_barrier_init(&barrier->pthread, &attr, parties);
+        pthread_barrierattr_destroy(&attr);
+        if (rc != 0) {
+            fprintf(stderr, "Error: pthread_barrier_init: %s\n", strerror(rc));
+            munmap(barrier, sizeof(barrier_t));
+            return NULL;
+        }
+    }
+    return barrier;
+}
+
+void barrier_free(barrier_t *barrier) {
+    if (barrier->kind == BARRIER_PTHREAD) {
+        pthread_barrier_destroy(&barrier->pthread);
+    }
+    munmap(barrier, sizeof(barrier_t));
+}
+
+void barrier_local_init(barrier_local_t *local, int id) {
+    local->id = id;
+    local->sense = 1;   // Shared flags start at 0, so the first episode releases on 1
+    local->parity = 0;
+}
+
+/**
+ * spin_pause() - One poll of a spinning waiter
+ *
+ * PAUSE (x86) / YIELD (arm64) for the first BARRIER_SPIN_LIMIT polls, then
+ * sched_yield() so an oversubscribed core runs the workers being waited on.
+ */
+static inline void spin_pause(int *polls) {
+    if (++*polls > BARRIER_SPIN_LIMIT) {
+        sched_yield();
+        return;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * sense_wait() - Centralized sense-reversing barrier
+ *
+ * The last of the N arrivals on the counter resets it and flips the global
+ * sense; the rest poll the sense. Reversing the sense every episode lets
+ * the barrier be reused without a second counter.
+ */
+static void sense_wait(barrier_t *barrier, barrier_local_t *local) {
+    if (__atomic_add_fetch(&barrier->count, 1, __ATOMIC_ACQ_REL) == barrier->parties) {
+        __atomic_store_n(&barrier->count, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&barrier->sense, local->sense, __ATOMIC_RELEASE);
+    } else {
+        int polls = 0;
+        while (__atomic_load_n(&barrier->sense, __ATOMIC_ACQUIRE) != local->sense) {
+            spin_pause(&polls);
+        }
+    }
+    local->sense = !local->sense;
+}
+
+/**
+ * dissem_wait() - Dissemination barrier (Hensgen, Finkel and Manber)
+ *
+ * After round k each worker has (transitively) heard from 2^(k+1) workers,
+ * so ceil(log2 N) rounds cover everyone. Two flag sets alternate (parity)
+ * and the sense flips every second episode, so flags are never reset.
+ */
+static void dissem_wait(barrier_t *barrier, barrier_local_t *local) {
+    for (int k = 0; k < barrier->rounds; k++) {
+        int partner = (local->id + (1 << k)) % barrier->parties;
+        __atomic_store_n(&barrier->flags[partner].flag[local->parity][k], local->sense,
+                         __ATOMIC_RELEASE);
+        int polls = 0;
+        while (__atomic_load_n(&barrier->flags[local->id].flag[local->parity][k],
+                               __ATOMIC_ACQUIRE) != local->sense) {
+            spin_pause(&polls);
+        }
+    }
+    if (local->parity == 1) {
+        local->sense = !local->sense;
+    }
+    local->parity = 1 - local->parity;
+}
+
+/**
+ * futex_wait() - Process-shared futex barrier
+ *
+ * The generation is read before arriving, so a waiter that races with the
+ * release sees FUTEX_WAIT fail with EAGAIN instead of sleeping through it.
+ */
+static void futex_wait(barrier_t *barrier) {
+    uint32_t generation = __atomic_load_n(&barrier->generation, __ATOMIC_ACQUIRE);
+    if (__atomic_add_fetch(&barrier->count, 1, __ATOMIC_ACQ_REL) == barrier->parties) {
+        __atomic_store_n(&barrier->count, 0, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&barrier->generation, 1, __ATOMIC_RELEASE);
+        syscall(SYS_futex, &barrier->generation, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+        return;
+    }
+    while (__atomic_load_n(&barrier->generation, __ATOMIC_ACQUIRE) == generation) {
+        syscall(SYS_futex, &barrier->generation, FUTEX_WAIT, generation, NULL, NULL, 0);
+    }
+}
+
+void barrier_wait(barrier_t *barrier, barrier_local_t *local) {
+    switch (barrier->kind) {
+    case BARRIER_PTHREAD:
+        pthread_barrier_wait(&barrier->pthread);
+        break;
+    case BARRIER_SENSE:
+        sense_wait(barrier, local);
+        break;
+    case BARRIER_DISSEM:
+        dissem_wait(barrier, local);
+        break;
+    case BARRIER_FUTEX:
+        futex_wait(barrier);
+        break;
+    }
+}
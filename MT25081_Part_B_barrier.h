@@ -0,0 +1,84 @@
+#ifndef BARRIER_H
+#define BARRIER_H
+
+/**
+ * Barrier implementations for the bsp worker.
+ *
+ * All four work across both progA processes and progB threads: a barrier_t
+ * lives in a MAP_SHARED mapping created before the workers start (see
+ * barrier_create()), so fork()ed children and threads see the same words.
+ *
+ *   BARRIER_PTHREAD - pthread_barrier_t with PTHREAD_PROCESS_SHARED
+ *   BARRIER_SENSE   - centralized sense-reversing barrier: one atomic
+ *                     counter, waiters spin on a global sense flag
+ *   BARRIER_DISSEM  - dissemination barrier: ceil(log2 N) rounds, in round
+ *                     k worker i signals worker (i + 2^k) mod N; no shared
+ *                     counter, each worker spins on its own cache line
+ *   BARRIER_FUTEX   - counter + generation word; waiters sleep in
+ *                     FUTEX_WAIT (shared, not FUTEX_PRIVATE) and the last
+ *                     arrival bumps the generation and wakes them all
+ *
+ * The spinning barriers pause for BARRIER_SPIN_LIMIT polls and then
+ * sched_yield() on every further poll: with more workers than cores a pure
+ * spin would burn the rest of its time slice while the worker it waits
+ * for is not running.
+ */
+
+#define BARRIER_MAX_PARTIES 128   // >= BENCH_MAX_WORKERS
+#define BARRIER_MAX_ROUNDS 7      // ceil(log2(BARRIER_MAX_PARTIES))
+#define BARRIER_SPIN_LIMIT 256    // Polls before a spinning waiter yields
+
+typedef enum {
+    BARRIER_PTHREAD = 0,
+    BARRIER_SENSE = 1,
+    BARRIER_DISSEM = 2,
+    BARRIER_FUTEX = 3
+} barrier_kind_t;
+
+/**
+ * Shared barrier state (opaque; lives in its own MAP_SHARED mapping)
+ */
+typedef struct barrier barrier_t;
+
+/**
+ * Per-party state (private to each worker)
+ */
+typedef struct {
+    int id;       // Party number 0..parties-1
+    int sense;    // SENSE / DISSEM: value that releases the current episode
+    int parity;   // DISSEM: flag set used by the current episode
+} barrier_local_t;
+
+/**
+ * Parses "pthread", "sense", "dissem" or "futex"; returns -1 if unknown
+ */
+int barrier_kind_parse(const char *name, barrier_kind_t *kind);
+
+/**
+ * Name of a barrier kind, as accepted by barrier_kind_parse()
+ */
+const char *barrier_kind_name(barrier_kind_t kind);
+
+/**
+ * Maps and initializes a barrier for parties (1..BARRIER_MAX_PARTIES)
+ * workers in MAP_SHARED anonymous memory, so it survives fork().
+ * Returns NULL (with the reason on stderr) on failure.
+ */
+barrier_t *barrier_create(barrier_kind_t kind, int parties);
+
+/**
+ * Destroys and unmaps a barrier from barrier_create()
+ */
+void barrier_free(barrier_t *barrier);
+
+/**
+ * Initializes a party's private state; id is 0..parties-1
+ */
+void barrier_local_init(barrier_local_t *local, int id);
+
+/**
+ * Blocks until all parties have called barrier_wait() for this episode
+ */
+void barrier_wait(barrier_t *barrier, barrier_local_t *local);
+
+#endif /* BARRIER_H */
@@ -0,0 +1,553 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_bench.h"
+#include "MT25081_Part_B_metrics.h"
+#include "MT25081_Part_B_timing.h"
+#include "MT25081_Part_B_bsp.h"
+#include "MT25081_Part_B_imbalance.h"
+#include "MT25081_Part_B_atomic.h"
+#include "MT25081_Part_B_signal.h"
+#include "MT25081_Part_B_fdchurn.h"
+#include "MT25081_Part_B_cow.h"
+#include "MT25081_Part_B_memacct.h"
+#include "MT25081_Part_B_kmem.h"
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+/**
+ *
+ * Driver-independent half of progA and progB.
+ *
+ * Everything measured or printed around the workers lives here, so a new
+ * option or metric is implemented once and both drivers pick it up. The
+ * backends (backends.c) differ only in how the N workers are started.
+ * ============================================================================
+ */
+
+/**
+ * print_usage() - Usage message for a driver
+ */
+static void print_usage(const char *prog, const bench_backend_t *backend) {
+    fprintf(stderr, "Usage: %s <worker_type> <num_%s> [options]\n", prog, backend->unit_plural);
+    fprintf(stderr, "worker_type: cpu, mem, io, bsp, imbalance, atomic, signal, fdchurn, cow,\n"
+                    "             idle, or a plugin worker (--worker-lib)\n");
+    fprintf(stderr, "num_%s: number of %s to create\n", backend->unit_plural, backend->unit_plural);
+    fprintf(stderr, "options: --mem-fraction=F --mem-passes=P --io-mode=truncate|prealloc\n");
+    fprintf(stderr, "         --target-seconds=S --calibrate-only --units=U\n");
+    fprintf(stderr, "         --worker-lib=PATH --worker-arg=S\n");
+    fprintf(stderr, "         --barrier=pthread|sense|dissem|futex --supersteps=S --bsp-slice=TERMS\n");
+    fprintf(stderr, "         --dist=uniform|exp|pareto --schedule=static|dynamic|guided[,CHUNK]\n");
+    fprintf(stderr, "         --tasks=T --task-cost=C --task-kernel=cpu|mem --rounds=R\n");
+    fprintf(stderr, "         --atomic-op=load|store|add|cas --order=relaxed|acqrel|seqcst\n");
+    fprintf(stderr, "         --location=shared|private --batches=B --batch-ops=K\n");
+    fprintf(stderr, "         --sig-send=kill|tgkill|pthread_kill --sig-recv=handler|sigwaitinfo|signalfd\n");
+    fprintf(stderr, "         --sig-pattern=ping|broadcast --signals=R\n");
+    fprintf(stderr, "         --fd-kind=file|pipe|eventfd|mix --fd-batches=B --fd-batch=C\n");
+    fprintf(stderr, "         --dataset-mb=M --cow-write=F --cow-batches=B --cow-lookups=L\n");
+    fprintf(stderr, "         --latency-probe=PERIOD_US --probe-policy=other|fifo|rr|batch|idle\n");
+    fprintf(stderr, "         --probe-priority=P --probe-cpu=C --latency-hist=PATH --smaps\n");
+    fprintf(stderr, "         --kmem --idle-ms=MS --idle-sleeps=S --procs=P (progH)\n");
+    fprintf(stderr, "         --quiet --startup\n");
+    fprintf(stderr, "         --kernel=VARIANT (cpu/mem templated kernels:");
+    for (int i = 0; i < tkernel_count(); i++) {
+        fprintf(stderr, " %s", tkernel_get(i)->name);
+    }
+    fprintf(stderr, ")\n");
+}
+
+void bench_parse_options(int argc, char *argv[], const bench_backend_t *backend,
+                         bench_config_t *cfg) {
+    // Input validation: Check for correct number of arguments
+    if (argc < 3) {
+        print_usage(argv[0], backend);
+        exit(EXIT_FAILURE);
+    }
+
+    // Parse command-line arguments
+    const work_params_t defaults = WORK_PARAMS_DEFAULT;
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->worker_type = argv[1];
+    cfg->num_workers = atoi(argv[2]);
+    cfg->work = defaults;
+    cfg->work.model = backend->model;
+    cfg->probe.cpu = -1;
+    cfg->procs = 2;
+
+    // Parse optional --key=value arguments
+    for (int a = 3; a < argc; a++) {
+        if (strncmp(argv[a], "--mem-fraction=", 15) == 0) {
+            cfg->mem_fraction = atof(argv[a] + 15);
+        } else if (strncmp(argv[a], "--mem-passes=", 13) == 0) {
+            cfg->work.mem_passes = atoi(argv[a] + 13);
+        } else if (strcmp(argv[a], "--io-mode=truncate") == 0) {
+            cfg->work.io_mode = IO_MODE_TRUNCATE;
+        } else if (strcmp(argv[a], "--io-mode=prealloc") == 0) {
+            cfg->work.io_mode = IO_MODE_PREALLOC;
+        } else if (strncmp(argv[a], "--target-seconds=", 17) == 0) {
+            cfg->target_seconds = atof(argv[a] + 17);
+        } else if (strcmp(argv[a], "--calibrate-only") == 0) {
+            cfg->calibrate_only = 1;
+        } else if (strncmp(argv[a], "--worker-lib=", 13) == 0) {
+            if (worker_load_plugin(argv[a] + 13) != 0) {
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--units=", 8) == 0) {
+            cfg->units = atoi(argv[a] + 8);
+            if (cfg->units < 1) {
+                fprintf(stderr, "Error: --units must be >= 1\n");
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--worker-arg=", 13) == 0) {
+            cfg->work.worker_arg = argv[a] + 13;
+        } else if (strncmp(argv[a], "--kernel=", 9) == 0) {
+            cfg->work.kernel = tkernel_find(argv[a] + 9);
+            if (cfg->work.kernel == NULL) {
+                fprintf(stderr, "Error: unknown kernel variant '%s'\n", argv[a] + 9);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--barrier=", 10) == 0) {
+            if (barrier_kind_parse(argv[a] + 10, &cfg->work.barrier) != 0) {
+                fprintf(stderr, "Error: unknown barrier '%s'\n", argv[a] + 10);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--supersteps=", 13) == 0) {
+            cfg->work.bsp_supersteps = atoi(argv[a] + 13);
+        } else if (strncmp(argv[a], "--bsp-slice=", 12) == 0) {
+            cfg->work.bsp_slice = atoi(argv[a] + 12);
+        } else if (strncmp(argv[a], "--dist=", 7) == 0) {
+            if (task_dist_parse(argv[a] + 7, &cfg->work.imb_dist) != 0) {
+                fprintf(stderr, "Error: unknown task distribution '%s'\n", argv[a] + 7);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--schedule=", 11) == 0) {
+            if (schedule_parse(argv[a] + 11, &cfg->work.imb_schedule, &cfg->work.imb_chunk) != 0) {
+                fprintf(stderr, "Error: invalid schedule '%s'\n", argv[a] + 11);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--task-kernel=", 14) == 0) {
+            if (task_kernel_parse(argv[a] + 14, &cfg->work.imb_kernel) != 0) {
+                fprintf(stderr, "Error: unknown task kernel '%s'\n", argv[a] + 14);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--tasks=", 8) == 0) {
+            cfg->work.imb_tasks = atoi(argv[a] + 8);
+        } else if (strncmp(argv[a], "--task-cost=", 12) == 0) {
+            cfg->work.imb_task_cost = atoi(argv[a] + 12);
+        } else if (strncmp(argv[a], "--rounds=", 9) == 0) {
+            cfg->work.imb_rounds = atoi(argv[a] + 9);
+        } else if (strncmp(argv[a], "--atomic-op=", 12) == 0) {
+            if (atomic_op_parse(argv[a] + 12, &cfg->work.atomic_op) != 0) {
+                fprintf(stderr, "Error: unknown atomic operation '%s'\n", argv[a] + 12);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--order=", 8) == 0) {
+            if (atomic_order_parse(argv[a] + 8, &cfg->work.atomic_order) != 0) {
+                fprintf(stderr, "Error: unknown memory order '%s'\n", argv[a] + 8);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--location=", 11) == 0) {
+            if (atomic_loc_parse(argv[a] + 11, &cfg->work.atomic_loc) != 0) {
+                fprintf(stderr, "Error: unknown location '%s'\n", argv[a] + 11);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--batches=", 10) == 0) {
+            cfg->work.atomic_batches = atoi(argv[a] + 10);
+        } else if (strncmp(argv[a], "--batch-ops=", 12) == 0) {
+            cfg->work.atomic_batch_ops = atoi(argv[a] + 12);
+        } else if (strncmp(argv[a], "--sig-send=", 11) == 0) {
+            if (signal_send_parse(argv[a] + 11, &cfg->work.sig_send) != 0) {
+                fprintf(stderr, "Error: unknown signal send call '%s'\n", argv[a] + 11);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--sig-recv=", 11) == 0) {
+            if (signal_recv_parse(argv[a] + 11, &cfg->work.sig_recv) != 0) {
+                fprintf(stderr, "Error: unknown signal consumption '%s'\n", argv[a] + 11);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--sig-pattern=", 14) == 0) {
+            if (signal_pattern_parse(argv[a] + 14, &cfg->work.sig_pattern) != 0) {
+                fprintf(stderr, "Error: unknown signal pattern '%s'\n", argv[a] + 14);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--signals=", 10) == 0) {
+            cfg->work.sig_rounds = atoi(argv[a] + 10);
+        } else if (strncmp(argv[a], "--fd-kind=", 10) == 0) {
+            if (fd_kind_parse(argv[a] + 10, &cfg->work.fd_kind) != 0) {
+                fprintf(stderr, "Error: unknown descriptor kind '%s'\n", argv[a] + 10);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--fd-batches=", 13) == 0) {
+            cfg->work.fd_batches = atoi(argv[a] + 13);
+        } else if (strncmp(argv[a], "--fd-batch=", 11) == 0) {
+            cfg->work.fd_batch = atoi(argv[a] + 11);
+        } else if (strncmp(argv[a], "--dataset-mb=", 13) == 0) {
+            cfg->work.cow_bytes = (size_t)atol(argv[a] + 13) << 20;
+        } else if (strncmp(argv[a], "--cow-write=", 12) == 0) {
+            cfg->work.cow_write = atof(argv[a] + 12);
+        } else if (strncmp(argv[a], "--cow-batches=", 14) == 0) {
+            cfg->work.cow_batches = atoi(argv[a] + 14);
+        } else if (strncmp(argv[a], "--cow-lookups=", 14) == 0) {
+            cfg->work.cow_lookups = atoi(argv[a] + 14);
+        } else if (strcmp(argv[a], "--smaps") == 0) {
+            cfg->smaps = 1;
+        } else if (strcmp(argv[a], "--kmem") == 0) {
+            cfg->kmem = 1;
+        } else if (strncmp(argv[a], "--idle-ms=", 10) == 0) {
+            cfg->work.idle_ms = atoi(argv[a] + 10);
+        } else if (strncmp(argv[a], "--idle-sleeps=", 14) == 0) {
+            cfg->work.idle_sleeps = atoi(argv[a] + 14);
+        } else if (strcmp(argv[a], "--quiet") == 0) {
+            cfg->quiet = 1;
+        } else if (strcmp(argv[a], "--startup") == 0) {
+            cfg->startup = 1;
+        } else if (strncmp(argv[a], "--procs=", 8) == 0) {
+            cfg->procs = atoi(argv[a] + 8);
+        } else if (strncmp(argv[a], "--latency-probe=", 16) == 0) {
+            cfg->probe.period_us = atoi(argv[a] + 16);
+        } else if (strncmp(argv[a], "--probe-policy=", 15) == 0) {
+            if (latency_policy_parse(argv[a] + 15, &cfg->probe.policy) != 0) {
+                fprintf(stderr, "Error: unknown scheduling policy '%s'\n", argv[a] + 15);
+                print_usage(argv[0], backend);
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[a], "--probe-priority=", 17) == 0) {
+            cfg->probe.priority = atoi(argv[a] + 17);
+        } else if (strncmp(argv[a], "--probe-cpu=", 12) == 0) {
+            cfg->probe.cpu = atoi(argv[a] + 12);
+        } else if (strncmp(argv[a], "--latency-hist=", 15) == 0) {
+            cfg->probe.hist_path = argv[a] + 15;
+        } else {
+            fprintf(stderr, "Error: unknown option '%s'\n", argv[a]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // Validate worker count (reasonable bounds to prevent system overload)
+    if (cfg->num_workers < 1 || cfg->num_workers > BENCH_MAX_WORKERS) {
+        fprintf(stderr, "Error: num_%s must be between 1 and %d\n",
+                backend->unit_plural, BENCH_MAX_WORKERS);
+        exit(EXIT_FAILURE);
+    }
+
+    // Validate worker type (a built-in or a loaded plugin)
+    cfg->ops = worker_find(cfg->worker_type);
+    if (cfg->ops == NULL) {
+        fprintf(stderr, "Error: unknown worker_type '%s'; available: ", cfg->worker_type);
+        worker_print_names(stderr);
+        exit(EXIT_FAILURE);
+    }
+    // --units overrides the worker's own count (e.g. one taken with --calibrate-only)
+    if (cfg->units > 0) {
+        *worker_units(cfg->ops, &cfg->work) = cfg->units;
+    }
+    if (cfg->work.bsp_supersteps < 1 || cfg->work.bsp_slice < 0) {
+        fprintf(stderr, "Error: --supersteps must be >= 1 and --bsp-slice >= 0\n");
+        exit(EXIT_FAILURE);
+    }
+    if (cfg->work.imb_rounds < 1 || cfg->work.imb_tasks < 1 || cfg->work.imb_task_cost < 1) {
+        fprintf(stderr, "Error: --rounds, --tasks and --task-cost must be >= 1\n");
+        exit(EXIT_FAILURE);
+    }
+    if (cfg->work.atomic_batches < 1 || cfg->work.atomic_batch_ops < 1) {
+        fprintf(stderr, "Error: --batches and --batch-ops must be >= 1\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (cfg->work.fd_batches < 1 || cfg->work.fd_batch < 1) {
+        fprintf(stderr, "Error: --fd-batches and --fd-batch must be >= 1\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (cfg->work.cow_bytes == 0 || cfg->work.cow_write < 0.0 || cfg->work.cow_write > 1.0 ||
+        cfg->work.cow_batches < 1 || cfg->work.cow_lookups < 1) {
+        fprintf(stderr, "Error: --dataset-mb, --cow-batches and --cow-lookups must be >= 1 "
+                        "and --cow-write in [0, 1]\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (cfg->work.idle_ms < 0 || cfg->work.idle_sleeps < 1) {
+        fprintf(stderr, "Error: --idle-ms must be >= 0 and --idle-sleeps >= 1\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Validate the hybrid split (more processes than workers is no hybrid)
+    if (cfg->procs < 1) {
+        fprintf(stderr, "Error: --procs must be >= 1\n");
+        exit(EXIT_FAILURE);
+    }
+    if (cfg->procs > cfg->num_workers) {
+        cfg->procs = cfg->num_workers;
+    }
+
+    // Validate signal options (the send call is checked by signal_setup())
+    if (cfg->work.sig_rounds < 1) {
+        fprintf(stderr, "Error: --signals must be >= 1\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Validate the latency probe (real-time policies need a priority 1..99)
+    int realtime = cfg->probe.policy == SCHED_FIFO || cfg->probe.policy == SCHED_RR;
+    if (realtime && cfg->probe.priority == 0) {
+        cfg->probe.priority = LATENCY_FIFO_PRIORITY;
+    }
+    if (cfg->probe.period_us < 0 || cfg->probe.cpu < -1 ||
+        (realtime ? cfg->probe.priority < 1 || cfg->probe.priority > 99
+                  : cfg->probe.priority != 0)) {
+        fprintf(stderr, "Error: --latency-probe must be >= 0, --probe-cpu >= 0 and "
+                        "--probe-priority 1..99 (fifo/rr only)\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Validate memory-pressure options (fraction of MemTotal or memory.max, capped at 4x)
+    if (cfg->mem_fraction < 0.0 || cfg->mem_fraction > 4.0 || cfg->work.mem_passes < 1) {
+        fprintf(stderr, "Error: --mem-fraction must be in [0, 4] (0 = off) and --mem-passes >= 1\n");
+        exit(EXIT_FAILURE);
+    }
+    if (cfg->mem_fraction > 0.0 && cfg->ops != &mem_worker_ops) {
+        fprintf(stderr, "Error: --mem-fraction requires worker_type 'mem'\n");
+        exit(EXIT_FAILURE);
+    }
+    if (cfg->work.kernel != NULL && strcmp(cfg->work.kernel->kind, cfg->ops->name) != 0) {
+        fprintf(stderr, "Error: --kernel=%s requires worker_type '%s'\n",
+                cfg->work.kernel->name, cfg->work.kernel->kind);
+        exit(EXIT_FAILURE);
+    }
+    if (cfg->target_seconds < 0.0) {
+        fprintf(stderr, "Error: --target-seconds must be positive\n");
+        exit(EXIT_FAILURE);
+    }
+    if (cfg->target_seconds > 0.0 && worker_has_setup(cfg->ops)) {
+        fprintf(stderr, "Error: --target-seconds cannot calibrate worker_type '%s' (a unit "
+                        "needs all N workers); size it with --units\n", cfg->ops->name);
+        exit(EXIT_FAILURE);
+    }
+    if (cfg->calibrate_only && cfg->target_seconds == 0.0) {
+        fprintf(stderr, "Error: --calibrate-only requires --target-seconds\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+int bench_worker_run(const bench_config_t *cfg, const char *tag, int worker_id) {
+    // --startup: only the first worker to get here stores its time
+    if (cfg->first_worker_ns != NULL) {
+        uint64_t unset = 0;
+        __atomic_compare_exchange_n(cfg->first_worker_ns, &unset, timing_monotonic_ns(), 0,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+
+    // init, timed run_unit() calls, report (*_STATS lines), teardown
+    const worker_ops_t *ops = cfg->ops;
+    worker_ctx_t ctx;
+    worker_ctx_init(&ctx, ops, tag, worker_id, &cfg->work);
+    if (cfg->memacct == NULL && cfg->kmemacct == NULL) {
+        return worker_run(ops, &ctx);
+    }
+
+    // --kmem/--smaps: the same steps with the kernel memory sample once all
+    // workers exist and the smaps sample at the peak; both are barriers a
+    // failed worker must still take part in
+    int inited = ops->init == NULL || ops->init(&ctx) == 0;
+    int rc = inited ? 0 : -1;
+    if (cfg->kmemacct != NULL) {
+        kmem_sample(cfg->kmemacct, worker_id);
+    }
+    for (int u = 0; rc == 0 && u < ctx.units; u++) {
+        rc = worker_unit(ops, &ctx);
+    }
+    if (cfg->memacct != NULL) {
+        memacct_sample(cfg->memacct, worker_id);
+    }
+    if (inited) {
+        worker_finish(ops, &ctx, rc);
+    }
+    return rc;
+}
+
+/**
+ * bench_main() - Shared driver flow
+ *
+ * WHAT IT DOES:
+ *   1. Parses and validates the command line
+ *   2. Sizes the mem array in memory-pressure mode
+ *   3. Calibrates the timer and (optionally) the work size
+ *   4. Runs the worker's setup hook: its shared barrier, counters and
+ *      result slots (bsp, imbalance, atomic, signal, fdchurn, cow), the
+ *      signal supervisor thread, the cow dataset
+ *   5. Runs the backend: N workers started and collected, next to the
+ *      wakeup latency probe if requested
+ *   6. Prints the latency report, runs the worker's cleanup hook, then
+ *      prints the smaps, kernel memory and memory-pressure reports, the
+ *      startup timestamps and the summary line
+ */
+int bench_main(int argc, char *argv[], const bench_backend_t *backend) {
+    // Taken before anything else, for --startup (exec-to-main latency)
+    uint64_t main_ns = timing_monotonic_ns();
+    bench_config_t cfg;
+    const char *tag = backend->tag;
+    bench_parse_options(argc, argv, backend, &cfg);
+
+    // MEMORY-PRESSURE SETUP: Split fraction * base evenly across workers,
+    // where base is MemTotal, or the cgroup's memory.max when that is lower
+    // (so MEM_MAX=2G with fraction 1.5 means 3G against a 2G limit)
+    pressure_snapshot_t before;
+    if (cfg.mem_fraction > 0.0) {
+        long long mem_total_kb = meminfo_read_kb("MemTotal");
+        if (mem_total_kb <= 0) {
+            fprintf(stderr, "Error: cannot read MemTotal from /proc/meminfo\n");
+            exit(EXIT_FAILURE);
+        }
+        long long mem_max_kb = cgroup_memory_max_kb();
+        int limited = mem_max_kb > 0 && mem_max_kb < mem_total_kb;
+        long long base_kb = limited ? mem_max_kb : mem_total_kb;
+        cfg.work.mem_bytes = (size_t)(cfg.mem_fraction * base_kb * 1024.0 / cfg.num_workers);
+        printf("[%s] Memory-pressure mode: %.2f x %s (%lld kB), %zu kB per %s, "
+               "MemTotal: %lld kB, cgroup memory.max: %lld kB\n",
+               tag, cfg.mem_fraction, limited ? "memory.max" : "MemTotal", base_kb,
+               cfg.work.mem_bytes / 1024, backend->unit_name, mem_total_kb, mem_max_kb);
+    }
+
+    // TIMER SETUP: Calibrate the tick counter once; workers inherit it.
+    // --startup runs measure their own launch, so they take the 1 ms window
+    uint64_t timer_ns = timing_monotonic_ns();
+    timing_init_window(cfg.startup ? TIMING_QUICK_CALIBRATION_NS : TIMING_CALIBRATION_NS);
+    timer_ns = timing_monotonic_ns() - timer_ns;
+
+    // CALIBRATION: Size the worker's loop count to the requested duration
+    if (cfg.target_seconds > 0.0) {
+        double unit_seconds;
+        int count = calibrate_work(cfg.ops, cfg.target_seconds, &cfg.work, &unit_seconds);
+        if (count < 0) {
+            fprintf(stderr, "Error: calibration probe for '%s' failed\n", cfg.worker_type);
+            exit(EXIT_FAILURE);
+        }
+        printf("[%s] CALIBRATION worker=%s target_s=%.3f unit_s=%.6f count=%d\n",
+               tag, cfg.worker_type, cfg.target_seconds, unit_seconds, count);
+
+        // --calibrate-only: the probe ran in a process nobody times; the
+        // measured run gets the count back through --units
+        if (cfg.calibrate_only) {
+            fflush(stdout);
+            return EXIT_SUCCESS;
+        }
+    }
+
+    // WORKER SETUP: The worker's own shared state, mapped before workers start
+    if (worker_setup(cfg.ops, &cfg.work, cfg.num_workers, tag) != 0) {
+        exit(EXIT_FAILURE);
+    }
+
+    // SMAPS SETUP: Slots and barrier for the per-process rollups (--smaps)
+    if (cfg.smaps) {
+        cfg.memacct = memacct_create(cfg.num_workers);
+        if (cfg.memacct == NULL) {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // KMEM SETUP: Shared snapshots; "before" is taken right before the run
+    if (cfg.kmem) {
+        cfg.kmemacct = kmem_create(cfg.num_workers);
+        if (cfg.kmemacct == NULL) {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // Memory-pressure counters start after calibration so the probe is excluded
+    if (cfg.mem_fraction > 0.0) {
+        pressure_snapshot(&before);
+    }
+
+    // STARTUP SETUP: One shared word the first worker stamps (--startup)
+    if (cfg.startup) {
+        cfg.first_worker_ns = mmap(NULL, sizeof(uint64_t), PROT_READ | PROT_WRITE,
+                                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (cfg.first_worker_ns == MAP_FAILED) {
+            perror("mmap");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!cfg.quiet) {
+        printf("[%s] Starting %d %s with worker type: %s\n",
+               tag, cfg.num_workers, backend->unit_plural, cfg.worker_type);
+        printf("[%s] Kernel clone selected: %s\n", tag, kernel_isa_level());
+        if (cfg.work.kernel != NULL) {
+            printf("[%s] Kernel variant: %s (elem=%s unroll=%d stride_bytes=%d)\n",
+                   tag, cfg.work.kernel->name, cfg.work.kernel->elem,
+                   cfg.work.kernel->unroll, cfg.work.kernel->stride_bytes);
+        }
+        printf("[%s] Timer: %s, %.6f ns/tick, %.1f ns/read\n",
+               tag, timing_source(), timing_ns_per_tick, timing_overhead_ns());
+        fflush(stdout);
+    }
+
+    // LATENCY PROBE: Timer thread in this process, sampling while workers run
+    if (cfg.probe.period_us > 0) {
+        if (latency_probe_start(&cfg.probe) != 0) {
+            exit(EXIT_FAILURE);
+        }
+        printf("[%s] LATENCY probe policy=%s priority=%d period_us=%d cpu=%d\n",
+               tag, latency_policy_name(cfg.probe.policy), cfg.probe.priority,
+               cfg.probe.period_us, cfg.probe.cpu);
+        fflush(stdout);
+    }
+
+    // EXECUTION: The only step that differs between drivers
+    if (cfg.kmemacct != NULL) {
+        kmem_snapshot(&cfg.kmemacct->before);
+    }
+    uint64_t run_ns = timing_monotonic_ns();
+    int completed = backend->run(backend, &cfg);
+
+    latency_probe_stop(tag);
+    worker_cleanup(cfg.ops, &cfg.work, tag);
+    if (cfg.memacct != NULL) {
+        memacct_report(tag, cfg.memacct);
+        memacct_free(cfg.memacct);
+    }
+    if (cfg.kmemacct != NULL) {
+        kmem_report(tag, cfg.kmemacct);
+        kmem_free(cfg.kmemacct);
+    }
+
+    // MEMORY-PRESSURE REPORT: Major faults of all workers via getrusage()
+    if (cfg.mem_fraction > 0.0) {
+        pressure_snapshot_t after;
+        pressure_snapshot(&after);
+        struct rusage usage;
+        getrusage(backend->rusage_who, &usage);
+        pressure_report(tag, &before, &after, usage.ru_majflt,
+                        (double)cfg.work.mem_bytes * cfg.work.mem_passes * cfg.num_workers);
+    }
+
+    // STARTUP REPORT: CLOCK_MONOTONIC stamps, comparable with the launcher's
+    if (cfg.first_worker_ns != NULL) {
+        uint64_t first_ns = *cfg.first_worker_ns;
+        printf("[%s] STARTUP main_ns=%llu run_ns=%llu first_worker_ns=%llu "
+               "timer_init_us=%.1f main_to_run_us=%.1f main_to_first_worker_us=%.1f\n",
+               tag, (unsigned long long)main_ns, (unsigned long long)run_ns,
+               (unsigned long long)first_ns, timer_ns / 1e3, (run_ns - main_ns) / 1e3,
+               first_ns > main_ns ? (first_ns - main_ns) / 1e3 : 0.0);
+        munmap(cfg.first_worker_ns, sizeof(uint64_t));
+    }
+
+    // All workers have completed - program is done
+    printf("[%s] ", tag);
+    printf(backend->summary_fmt, completed);
+    printf("\n");
+    fflush(stdout);
+
+    return EXIT_SUCCESS;
+}
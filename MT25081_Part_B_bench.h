@@ -0,0 +1,93 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_registry.h"
+#include "MT25081_Part_B_latency.h"
+
+/**
+ * Benchmark core shared by all drivers (built into libpa01bench.a).
+ *
+ * bench_main() does everything that does not depend on how workers are
+ * started: option parsing and validation, worker lookup, timer setup,
+ * calibration, memory-pressure metrics and the startup/summary report.
+ * An execution backend only starts N workers and waits for them, so a
+ * process vs thread comparison differs in the backend and nothing else.
+ */
+
+/**
+ * Parsed command line of one run
+ */
+typedef struct {
+    const char *worker_type;   // Registry name of the worker
+    const worker_ops_t *ops;   // Registry entry for worker_type
+    int num_workers;           // Processes / threads to start (1..BENCH_MAX_WORKERS)
+    double mem_fraction;       // 0 = memory-pressure mode disabled
+    double target_seconds;     // 0 = fixed work size (no calibration)
+    int calibrate_only;        // 1 = print the CALIBRATION line and exit (--calibrate-only)
+    int units;                 // run_unit() calls per worker (--units), 0 = the worker's default
+    work_params_t work;        // Work size shared by all workers
+    latency_params_t probe;    // Wakeup latency probe next to the workers
+    int smaps;                 // 1 = per-process smaps_rollup accounting (--smaps)
+    struct memacct *memacct;   // Its shared state (bench_main()), NULL = off
+    int kmem;                  // 1 = kernel memory per worker (--kmem)
+    struct kmem_account *kmemacct; // Its shared state (bench_main()), NULL = off
+    int procs;                 // Processes the hybrid backend spreads workers over (--procs)
+    int quiet;                 // 1 = no startup banner or per-worker lifecycle lines (--quiet)
+    int startup;               // 1 = print the STARTUP timestamps (--startup)
+    uint64_t *first_worker_ns; // MAP_SHARED start of the first worker (--startup), NULL = off
+} bench_config_t;
+
+#define BENCH_MAX_WORKERS 100
+
+/**
+ * Execution backend: how a driver starts and collects its workers
+ */
+typedef struct bench_backend {
+    const char *tag;           // Output prefix, e.g. "progA"
+    const char *unit_name;     // Worker noun for messages, e.g. "process"
+    const char *unit_plural;   // e.g. "processes"
+    const char *summary_fmt;   // Final line, %d = completed workers
+    /**
+     * Starts cfg->num_workers workers, each calling bench_worker_run() with
+     * self->tag and its id (1..N), and waits for all of them. Returns the
+     * number that completed.
+     */
+    int (*run)(const struct bench_backend *self, const bench_config_t *cfg);
+    /**
+     * getrusage() target covering all workers' faults after run():
+     * RUSAGE_CHILDREN for processes, RUSAGE_SELF for threads
+     */
+    int rusage_who;
+    worker_model_t model;      // Copied to cfg->work.model for worker setup hooks
+} bench_backend_t;
+
+extern const bench_backend_t fork_backend;     // progA: fork() + waitpid()
+extern const bench_backend_t pthread_backend;  // progB: pthread_create() + pthread_join()
+extern const bench_backend_t hybrid_backend;   // progH: --procs processes of threads
+extern const bench_backend_t omp_backend;      // progO: OpenMP team (backend_omp.c, -fopenmp,
+                                               //        linked into progO, not the library)
+
+/**
+ * Parses "<worker_type> <num> [options]" into *cfg. Prints usage or the
+ * error to stderr and exits on invalid input.
+ */
+void bench_parse_options(int argc, char *argv[], const bench_backend_t *backend,
+                         bench_config_t *cfg);
+
+/**
+ * Runs one worker to completion inside a backend's process or thread:
+ * fills a worker_ctx_t for worker_id and calls worker_run(), or with
+ * --kmem/--smaps samples memory after init and between the last unit and
+ * the report. With --startup the first caller records its start time.
+ * Returns 0 on success, -1 if the worker failed.
+ */
+int bench_worker_run(const bench_config_t *cfg, const char *tag, int worker_id);
+
+/**
+ * Complete driver: parse, set up, run the backend and report.
+ * Returns the process exit status.
+ */
+int bench_main(int argc, char *argv[], const bench_backend_t *backend);
+
+#endif /* BENCH_H */
@@ -0,0 +1,154 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_bsp.h"
+#include "MT25081_Part_B_timing.h"
+#include <sched.h>
+#include <sys/mman.h>
+
+/**
+ *
+ * bsp worker: compute slice + global barrier per superstep (see bsp.h).
+ *
+ * A superstep only means something across all N workers, so the worker
+ * needs bsp_setup()'s shared barrier (--target-seconds is refused for it).
+ * ============================================================================
+ */
+
+int bsp_setup(work_params_t *work, int num_workers, const char *tag) {
+    bsp_shared_t *shared = mmap(NULL, sizeof(bsp_shared_t), PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+    shared->barrier = barrier_create(work->barrier, num_workers);
+    if (shared->barrier == NULL) {
+        munmap(shared, sizeof(bsp_shared_t));
+        return -1;
+    }
+    shared->parties = num_workers;
+    work->bsp = shared;
+    printf("[%s] BSP barrier=%s supersteps=%d slice_terms=%d\n",
+           tag, barrier_kind_name(work->barrier), work->bsp_supersteps, work->bsp_slice);
+    return 0;
+}
+
+void bsp_cleanup(work_params_t *work, const char *tag) {
+    (void)tag;
+    if (work->bsp != NULL) {
+        barrier_free(work->bsp->barrier);
+        munmap(work->bsp, sizeof(bsp_shared_t));
+        work->bsp = NULL;
+    }
+}
+
+/**
+ * Per-worker state
+ */
+typedef struct {
+    barrier_t *barrier;         // Shared barrier (bsp_setup())
+    barrier_local_t local;
+    int slice;                  // Leibniz terms per superstep
+    unit_stats_t compute_stats;
+    unit_stats_t wait_stats;
+} bsp_state_t;
+
+static int bsp_init(worker_ctx_t *ctx) {
+    const bsp_shared_t *shared = ctx->work->bsp;
+    if (shared == NULL || ctx->worker_id < 1 || ctx->worker_id > shared->parties) {
+        fprintf(stderr, "bsp worker %d: no shared state (bsp_setup() not run)\n",
+                ctx->worker_id);
+        return -1;
+    }
+    bsp_state_t *bsp = (bsp_state_t *)calloc(1, sizeof(bsp_state_t));
+    if (bsp == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    bsp->barrier = shared->barrier;
+    barrier_local_init(&bsp->local, ctx->worker_id - 1);
+    bsp->slice = ctx->work->bsp_slice;
+    ctx->state = bsp;
+    return 0;
+}
+
+static int bsp_run_unit(worker_ctx_t *ctx) {
+    bsp_state_t *bsp = (bsp_state_t *)ctx->state;
+
+    // COMPUTE PHASE: this worker's share of the superstep
+    uint64_t t0 = timing_now();
+    double pi = leibniz_kernel(0.0, bsp->slice);
+    DO_NOT_OPTIMIZE(pi);
+    uint64_t t1 = timing_now();
+
+    // SYNCHRONIZATION PHASE: nobody starts superstep s+1 before all finish s
+    barrier_wait(bsp->barrier, &bsp->local);
+    uint64_t t2 = timing_now();
+
+    unit_stats_add(&bsp->compute_stats, t1 - t0);
+    unit_stats_add(&bsp->wait_stats, t2 - t1);
+    return 0;
+}
+
+static void bsp_teardown(worker_ctx_t *ctx) {
+    free(ctx->state);
+    ctx->state = NULL;
+}
+
+/**
+ * bsp_print_result() - Aggregates all workers' slots into BSP_RESULT
+ */
+static void bsp_print_result(const char *tag, const bsp_shared_t *shared,
+                             barrier_kind_t kind, int slice) {
+    uint64_t compute = 0, wait = 0, max_wait = 0;
+    long long steps = 0;
+    for (int i = 0; i < shared->parties; i++) {
+        const bsp_slot_t *slot = &shared->slots[i];
+        compute += slot->compute_ticks;
+        wait += slot->wait_ticks;
+        steps += slot->supersteps;
+        if (slot->max_wait_ticks > max_wait) {
+            max_wait = slot->max_wait_ticks;
+        }
+    }
+    double compute_ns = steps ? timing_ticks_to_ns(compute) / steps : 0.0;
+    double wait_ns = steps ? timing_ticks_to_ns(wait) / steps : 0.0;
+    double efficiency = (compute + wait) ? 100.0 * compute / (compute + wait) : 0.0;
+
+    // Best case on the CPUs this run may use: with more workers than CPUs a
+    // worker can only compute for cpus/N of each superstep
+    cpu_set_t set;
+    int cpus = sched_getaffinity(0, sizeof(set), &set) == 0 ? CPU_COUNT(&set) : 1;
+    double ideal = cpus >= shared->parties ? 100.0 : 100.0 * cpus / shared->parties;
+
+    printf("[%s] BSP_RESULT barrier=%s workers=%d cpus=%d supersteps=%d slice_terms=%d "
+           "compute_ns=%.1f barrier_ns=%.1f barrier_max_ns=%.1f step_ns=%.1f "
+           "efficiency_pct=%.2f ideal_pct=%.2f\n",
+           tag, barrier_kind_name(kind), shared->parties, cpus, shared->slots[0].supersteps,
+           slice, compute_ns, wait_ns, timing_ticks_to_ns(max_wait), compute_ns + wait_ns,
+           efficiency, ideal);
+    fflush(stdout);
+}
+
+static void bsp_report(const worker_ctx_t *ctx) {
+    bsp_state_t *bsp = (bsp_state_t *)ctx->state;
+    unit_stats_print(ctx->tag, "BSP_COMPUTE_STATS", ctx->worker_id, &bsp->compute_stats);
+    unit_stats_print(ctx->tag, "BSP_BARRIER_STATS", ctx->worker_id, &bsp->wait_stats);
+
+    // Publish this worker's totals, then one more barrier so worker 1 reads
+    // every slot only after all of them are written
+    bsp_shared_t *shared = ctx->work->bsp;
+    bsp_slot_t *slot = &shared->slots[ctx->worker_id - 1];
+    slot->supersteps = bsp->wait_stats.units;
+    slot->compute_ticks = bsp->compute_stats.total_ticks;
+    slot->wait_ticks = bsp->wait_stats.total_ticks;
+    slot->max_wait_ticks = bsp->wait_stats.max_ticks;
+    barrier_wait(bsp->barrier, &bsp->local);
+    if (ctx->worker_id == 1) {
+        bsp_print_result(ctx->tag, shared, ctx->work->barrier, bsp->slice);
+    }
+}
+
+const worker_ops_t bsp_worker_ops = {
+    WORKER_API_VERSION, "bsp", "one superstep: compute slice + global barrier",
+    bsp_init, bsp_run_unit, bsp_teardown, bsp_report
+};
@@ -0,0 +1,60 @@
+#ifndef BSP_H
+#define BSP_H
+
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_barrier.h"
+
+/**
+ * Bulk-synchronous (BSP) worker.
+ *
+ * One unit is a superstep: work->bsp_slice Leibniz terms of compute, then a
+ * global barrier across all N workers (work->barrier selects the
+ * implementation, see barrier.h). Compute and barrier-wait time are timed
+ * separately, and after the last superstep worker 1 prints a
+ * "[tag] BSP_RESULT ..." line aggregated over all workers:
+ *
+ *   barrier_ns     - mean time a worker spends in one barrier (latency plus
+ *                    waiting for the slowest worker of the superstep)
+ *   efficiency_pct - compute time / (compute + barrier time), all workers
+ *   ideal_pct      - the best efficiency possible on the allowed CPUs,
+ *                    100 * min(1, cpus / N) (oversubscribed cores)
+ *
+ * With --bsp-slice=0 every superstep is a bare barrier, so barrier_ns is
+ * the cost of the barrier itself.
+ */
+
+/**
+ * Per-worker totals, published to the shared region for the BSP_RESULT line
+ */
+typedef struct {
+    int supersteps;
+    uint64_t compute_ticks;
+    uint64_t wait_ticks;
+    uint64_t max_wait_ticks;
+} __attribute__((aligned(64))) bsp_slot_t;
+
+/**
+ * State shared by all workers of a run (MAP_SHARED, created before fork)
+ */
+typedef struct bsp_shared {
+    barrier_t *barrier;                      // Separate shared mapping
+    int parties;                             // Number of workers
+    bsp_slot_t slots[BARRIER_MAX_PARTIES];   // Indexed by worker_id - 1
+} bsp_shared_t;
+
+/**
+ * Setup hook: maps the barrier and result slots for num_workers workers,
+ * stores them in work->bsp and prints the "[tag] BSP ..." line. Must run
+ * before the workers start. Returns -1 (reason on stderr) on failure.
+ */
+int bsp_setup(work_params_t *work, int num_workers, const char *tag);
+
+/**
+ * Cleanup hook: unmaps the shared state from bsp_setup() (after all
+ * workers finished)
+ */
+void bsp_cleanup(work_params_t *work, const char *tag);
+
+extern const worker_ops_t bsp_worker_ops;
+
+#endif /* BSP_H */
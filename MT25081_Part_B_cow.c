@@ -0,0 +1,280 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_cow.h"
+#include "MT25081_Part_B_timing.h"
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+/**
+ *
+ * cow worker: a table built once and shared copy-on-write (see cow.h).
+ *
+ * Minor faults are counted with getrusage(RUSAGE_THREAD), which is the
+ * worker alone in both drivers. Each worker writes its own word of every
+ * modified page (worker id modulo the words in a page), so threads sharing
+ * the table never store to the same word. The table is built once by
+ * cow_setup(), so the worker needs it (--target-seconds is refused for it).
+ * ============================================================================
+ */
+
+#define COW_PAGE_WORDS (4096 / sizeof(uint64_t))
+
+/**
+ * table_map() - Maps and fills a table of bytes; NULL (reason on stderr)
+ * on failure
+ */
+static uint64_t *table_map(size_t bytes) {
+    uint64_t *table = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (table == MAP_FAILED) {
+        perror("mmap dataset");
+        return NULL;
+    }
+    size_t entries = bytes / sizeof(uint64_t);
+    for (size_t i = 0; i < entries; i++) {
+        table[i] = i * 0x9E3779B97F4A7C15ULL;
+    }
+    return table;
+}
+
+int cow_setup(work_params_t *work, int num_workers, const char *tag) {
+    cow_shared_t *shared = mmap(NULL, sizeof(cow_shared_t), PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+    shared->barrier = barrier_create(BARRIER_FUTEX, num_workers);
+    if (shared->barrier == NULL) {
+        munmap(shared, sizeof(cow_shared_t));
+        return -1;
+    }
+    uint64_t t0 = timing_now();
+    shared->table = table_map(work->cow_bytes);
+    if (shared->table == NULL) {
+        barrier_free(shared->barrier);
+        munmap(shared, sizeof(cow_shared_t));
+        return -1;
+    }
+    shared->build_s = timing_ticks_to_s(timing_now() - t0);
+    shared->bytes = work->cow_bytes;
+    shared->parties = num_workers;
+    shared->driver_pid = (int)getpid();
+    work->cow = shared;
+    printf("[%s] COW dataset_mb=%zu write_fraction=%.3f batches=%d lookups=%d build_s=%.3f\n",
+           tag, work->cow_bytes >> 20, work->cow_write, work->cow_batches, work->cow_lookups,
+           shared->build_s);
+    return 0;
+}
+
+void cow_cleanup(work_params_t *work, const char *tag) {
+    (void)tag;
+    if (work->cow != NULL) {
+        munmap(work->cow->table, work->cow->bytes);
+        barrier_free(work->cow->barrier);
+        munmap(work->cow, sizeof(cow_shared_t));
+        work->cow = NULL;
+    }
+}
+
+/**
+ * Per-worker state
+ */
+typedef struct {
+    cow_shared_t *shared;        // cow_setup()'s state
+    barrier_local_t local;
+    uint64_t *table;             // shared->table
+    size_t entries;
+    uint64_t rng;                // xorshift64 state for lookup indices
+    int id;                      // 0..parties-1
+    cow_slot_t totals;
+} cow_state_t;
+
+/**
+ * minor_faults() - Minor faults of the calling thread so far
+ */
+static long minor_faults(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_THREAD, &usage);
+    return usage.ru_minflt;
+}
+
+/**
+ * cow_dirty() - Writes one word of work->cow_write of the table's pages,
+ * spread evenly: page p is modified when floor((p + 1) * F) > floor(p * F)
+ */
+static void cow_dirty(cow_state_t *cs, double fraction) {
+    size_t pages = cs->entries / COW_PAGE_WORDS;
+    size_t word = (size_t)cs->id % COW_PAGE_WORDS;
+    cow_slot_t *totals = &cs->totals;
+
+    long faults = minor_faults();
+    uint64_t t0 = timing_now();
+    for (size_t p = 0; p < pages; p++) {
+        if ((long long)((p + 1) * fraction) > (long long)(p * fraction)) {
+            __atomic_store_n(&cs->table[p * COW_PAGE_WORDS + word], (uint64_t)cs->id + 1,
+                             __ATOMIC_RELAXED);
+            totals->dirty_pages++;
+        }
+    }
+    totals->dirty_ticks = timing_now() - t0;
+    totals->dirty_faults = minor_faults() - faults;
+}
+
+static int cow_init(worker_ctx_t *ctx) {
+    const work_params_t *work = ctx->work;
+    cow_shared_t *shared = work->cow;
+    if (shared == NULL || ctx->worker_id < 1 || ctx->worker_id > shared->parties) {
+        fprintf(stderr, "cow worker %d: no shared state (cow_setup() not run)\n",
+                ctx->worker_id);
+        return -1;
+    }
+    cow_state_t *cs = (cow_state_t *)calloc(1, sizeof(cow_state_t));
+    if (cs == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    cs->shared = shared;
+    cs->id = ctx->worker_id - 1;
+    barrier_local_init(&cs->local, cs->id);
+    cs->table = shared->table;
+    cs->entries = work->cow_bytes / sizeof(uint64_t);
+    cs->rng = 0x2545F4914F6CDD1DULL * (uint64_t)(ctx->worker_id + 1);
+    cs->totals.pid = (int)getpid();
+    ctx->state = cs;
+
+    if (work->cow_write > 0.0) {
+        cow_dirty(cs, work->cow_write);
+    }
+    return 0;
+}
+
+static int cow_run_unit(worker_ctx_t *ctx) {
+    cow_state_t *cs = (cow_state_t *)ctx->state;
+    const uint64_t *table = cs->table;
+    size_t entries = cs->entries;
+    uint64_t x = cs->rng;
+    uint64_t sum = 0;
+    int lookups = ctx->work->cow_lookups;
+
+    long faults = minor_faults();
+    uint64_t t0 = timing_now();
+    for (int i = 0; i < lookups; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        sum += table[x % entries];
+    }
+    uint64_t t1 = timing_now();
+    DO_NOT_OPTIMIZE(sum);
+    cs->rng = x;
+
+    cow_slot_t *totals = &cs->totals;
+    if (totals->lookups == 0) {
+        totals->first_tick = t0;
+    }
+    totals->last_tick = t1;
+    totals->ticks += t1 - t0;
+    totals->lookups += lookups;
+    totals->lookup_faults += minor_faults() - faults;
+    return 0;
+}
+
+static void cow_teardown(worker_ctx_t *ctx) {
+    free(ctx->state);
+    ctx->state = NULL;
+}
+
+/**
+ * cow_add_process() - Adds one process's memory to the totals (kB)
+ */
+static void cow_add_process(const smaps_rollup_t *mem, long long *rss, long long *pss,
+                            long long *uss) {
+    *rss += mem->rss_kb;
+    *pss += mem->pss_kb;
+    *uss += smaps_uss_kb(mem);
+}
+
+/**
+ * cow_print_result() - Throughput, COW faults and memory over all slots.
+ * Threads of one process publish the same rollup; it is counted once.
+ */
+static void cow_print_result(const char *tag, const cow_shared_t *shared,
+                             const work_params_t *work) {
+    long long lookups = 0, dirty_pages = 0, rss = 0, pss = 0, uss = 0;
+    long cow_faults = 0, lookup_faults = 0;
+    uint64_t first = UINT64_MAX, last = 0, dirty_max = 0;
+    int processes = 0, driver_seen = 0;
+    for (int i = 0; i < shared->parties; i++) {
+        const cow_slot_t *slot = &shared->slots[i];
+        lookups += slot->lookups;
+        dirty_pages += slot->dirty_pages;
+        cow_faults += slot->dirty_faults;
+        lookup_faults += slot->lookup_faults;
+        first = slot->first_tick < first ? slot->first_tick : first;
+        last = slot->last_tick > last ? slot->last_tick : last;
+        dirty_max = slot->dirty_ticks > dirty_max ? slot->dirty_ticks : dirty_max;
+
+        int seen = 0;
+        for (int j = 0; j < i && !seen; j++) {
+            seen = shared->slots[j].pid == slot->pid;
+        }
+        if (!seen) {
+            cow_add_process(&slot->mem, &rss, &pss, &uss);
+            processes++;
+            driver_seen |= slot->pid == shared->driver_pid;
+        }
+    }
+    if (!driver_seen) {
+        cow_add_process(&shared->driver_mem, &rss, &pss, &uss);
+        processes++;
+    }
+    double wall_s = last > first ? timing_ticks_to_s(last - first) : 0.0;
+
+    cpu_set_t set;
+    int cpus = sched_getaffinity(0, sizeof(set), &set) == 0 ? CPU_COUNT(&set) : 1;
+
+    printf("[%s] COW_RESULT dataset_mb=%zu write_fraction=%.3f workers=%d processes=%d "
+           "cpus=%d lookups=%lld wall_s=%.3f mlookups_per_s=%.2f dirty_pages=%lld "
+           "cow_faults=%ld lookup_faults=%ld dirty_ms_max=%.2f rss_total_mb=%.1f "
+           "pss_total_mb=%.1f uss_total_mb=%.1f pss_per_worker_mb=%.1f\n",
+           tag, shared->bytes >> 20, work->cow_write, shared->parties, processes, cpus,
+           lookups, wall_s, wall_s > 0.0 ? lookups / wall_s / 1e6 : 0.0, dirty_pages,
+           cow_faults, lookup_faults, timing_ticks_to_ns(dirty_max) / 1e6, rss / 1024.0,
+           pss / 1024.0, uss / 1024.0, pss / 1024.0 / shared->parties);
+    fflush(stdout);
+}
+
+static void cow_report(const worker_ctx_t *ctx) {
+    cow_state_t *cs = (cow_state_t *)ctx->state;
+    cow_slot_t *totals = &cs->totals;
+    double busy_s = timing_ticks_to_s(totals->ticks);
+    printf("[%s] COW_STATS worker=%d batches=%d lookups=%lld mlookups_per_s=%.2f "
+           "dirty_pages=%lld cow_faults=%ld dirty_ms=%.2f lookup_faults=%ld\n",
+           ctx->tag, ctx->worker_id, ctx->stats.units, totals->lookups,
+           busy_s > 0.0 ? totals->lookups / busy_s / 1e6 : 0.0, totals->dirty_pages,
+           totals->dirty_faults, timing_ticks_to_ns(totals->dirty_ticks) / 1e6,
+           totals->lookup_faults);
+    fflush(stdout);
+
+    // First barrier: every worker has made its copies, none has exited, so
+    // the rollups read now are the peak footprint. Second barrier: worker 1
+    // prints only once all rollups are published.
+    cow_shared_t *shared = cs->shared;
+    barrier_wait(shared->barrier, &cs->local);
+    smaps_rollup_read(0, &totals->mem);
+    if (cs->id == 0 && shared->driver_pid != totals->pid) {
+        smaps_rollup_read(shared->driver_pid, &shared->driver_mem);
+    }
+    shared->slots[cs->id] = *totals;
+    barrier_wait(shared->barrier, &cs->local);
+    if (cs->id == 0) {
+        cow_print_result(ctx->tag, shared, ctx->work);
+    }
+}
+
+const worker_ops_t cow_worker_ops = {
+    WORKER_API_VERSION, "cow", "one batch of random lookups in the shared dataset",
+    cow_init, cow_run_unit, cow_teardown, cow_report
+};
@@ -0,0 +1,76 @@
+#ifndef COW_H
+#define COW_H
+
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_barrier.h"
+#include "MT25081_Part_B_metrics.h"
+
+/**
+ * Copy-on-write shared dataset worker.
+ *
+ * The driver builds one lookup table of work->cow_bytes (MAP_PRIVATE
+ * anonymous memory, every page written) before any worker starts. progA's
+ * children inherit it copy-on-write through fork(); progB's threads use the
+ * very same pages directly. Each worker then:
+ *
+ *   1. modifies work->cow_write of the table's pages (one word per page,
+ *      the same pages in every worker), counting its minor faults: in a
+ *      child each is a COW copy of a 4 KiB page, in a thread there are none
+ *   2. runs the timed units: one unit is work->cow_lookups random 8-byte
+ *      reads from the table
+ *
+ * After the last batch every worker reads its process's smaps_rollup while
+ * all are still alive, and worker 1 prints a "[tag] COW_RESULT ..." line:
+ * lookup throughput, COW faults, and the RSS, PSS and USS of all processes
+ * involved (workers plus, for progA, the driver that built the table).
+ * rss_total double-counts the shared table; pss_total does not.
+ */
+
+/**
+ * Per-worker totals, published to the shared region for COW_RESULT
+ */
+typedef struct {
+    int pid;                 // getpid() of the worker
+    long long lookups;       // Table reads made
+    uint64_t ticks;          // Time in lookup batches
+    uint64_t first_tick;     // Start of the first batch
+    uint64_t last_tick;      // End of the last batch
+    long long dirty_pages;   // Pages modified before the first batch
+    uint64_t dirty_ticks;    // Time spent modifying them
+    long dirty_faults;       // Minor faults while modifying (COW copies)
+    long lookup_faults;      // Minor faults during the lookup batches
+    smaps_rollup_t mem;      // The worker's process after the last batch
+} __attribute__((aligned(64))) cow_slot_t;
+
+/**
+ * State shared by all workers of a run (MAP_SHARED, created before fork).
+ * The table itself is MAP_PRIVATE, so fork() gives each child a COW view
+ * at the same address.
+ */
+typedef struct cow_shared {
+    barrier_t *barrier;                      // Result barriers
+    int parties;                             // Number of workers
+    int driver_pid;                          // Process that built the table
+    uint64_t *table;                         // The dataset
+    size_t bytes;                            // Its size
+    double build_s;                          // Time to build it
+    smaps_rollup_t driver_mem;               // Driver's memory (progA), read by worker 1
+    cow_slot_t slots[BARRIER_MAX_PARTIES];   // Indexed by worker_id - 1
+} cow_shared_t;
+
+/**
+ * Setup hook: maps the barrier and result slots for num_workers workers,
+ * builds the work->cow_bytes table, stores both in work->cow and prints
+ * the "[tag] COW" line. Must run before the workers start, so fork()
+ * shares the table. Returns -1 (reason on stderr) on failure.
+ */
+int cow_setup(work_params_t *work, int num_workers, const char *tag);
+
+/**
+ * Cleanup hook: unmaps the table and shared state from cow_setup()
+ */
+void cow_cleanup(work_params_t *work, const char *tag);
+
+extern const worker_ops_t cow_worker_ops;
+
+#endif /* COW_H */
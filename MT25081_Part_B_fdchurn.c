@@ -0,0 +1,230 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_fdchurn.h"
+#include "MT25081_Part_B_timing.h"
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+
+/**
+ *
+ * fdchurn worker: descriptor allocation rate, shared vs private fd table
+ * (see fdchurn.h).
+ *
+ * Every descriptor is created with O_CLOEXEC/F_DUPFD_CLOEXEC so a fork by
+ * another worker never inherits a half-finished cycle. The result slots
+ * live in fdchurn_setup()'s shared mapping, so the worker needs it
+ * (--target-seconds is refused for it).
+ * ============================================================================
+ */
+
+static const char *const kind_names[] = {"file", "pipe", "eventfd", "mix"};
+
+int fd_kind_parse(const char *name, fd_kind_t *kind) {
+    for (int k = 0; k < 4; k++) {
+        if (strcmp(name, kind_names[k]) == 0) {
+            *kind = (fd_kind_t)k;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *fd_kind_name(fd_kind_t kind) {
+    return kind_names[kind];
+}
+
+int fdchurn_setup(work_params_t *work, int num_workers, const char *tag) {
+    fdchurn_shared_t *shared = mmap(NULL, sizeof(fdchurn_shared_t), PROT_READ | PROT_WRITE,
+                                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+    shared->barrier = barrier_create(BARRIER_FUTEX, num_workers);
+    if (shared->barrier == NULL) {
+        munmap(shared, sizeof(fdchurn_shared_t));
+        return -1;
+    }
+    shared->parties = num_workers;
+    work->fdchurn = shared;
+    printf("[%s] FDCHURN kind=%s batches=%d batch_cycles=%d\n",
+           tag, fd_kind_name(work->fd_kind), work->fd_batches, work->fd_batch);
+    return 0;
+}
+
+void fdchurn_cleanup(work_params_t *work, const char *tag) {
+    (void)tag;
+    if (work->fdchurn != NULL) {
+        barrier_free(work->fdchurn->barrier);
+        munmap(work->fdchurn, sizeof(fdchurn_shared_t));
+        work->fdchurn = NULL;
+    }
+}
+
+/**
+ * Per-worker state
+ */
+typedef struct {
+    fdchurn_shared_t *shared;    // fdchurn_setup()'s state
+    barrier_local_t local;
+    int id;                      // 0..parties-1
+    fdchurn_slot_t totals;
+} fdchurn_state_t;
+
+/**
+ * churn_file() / churn_pipe() / churn_eventfd() - One cycle each; return
+ * the number of calls made, or -1 (reason on stderr) on failure
+ */
+static int churn_file(void) {
+    int fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        perror("open /dev/null");
+        return -1;
+    }
+    int copy = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    close(fd);
+    if (copy < 0) {
+        perror("dup");
+        return -1;
+    }
+    close(copy);
+    return 4;
+}
+
+static int churn_pipe(void) {
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0) {
+        perror("pipe2");
+        return -1;
+    }
+    close(fds[0]);
+    close(fds[1]);
+    return 3;
+}
+
+static int churn_eventfd(void) {
+    int fd = eventfd(0, EFD_CLOEXEC);
+    if (fd < 0) {
+        perror("eventfd");
+        return -1;
+    }
+    int copy = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    close(fd);
+    if (copy < 0) {
+        perror("dup");
+        return -1;
+    }
+    close(copy);
+    return 4;
+}
+
+static int fdchurn_init(worker_ctx_t *ctx) {
+    fdchurn_shared_t *shared = ctx->work->fdchurn;
+    if (shared == NULL || ctx->worker_id < 1 || ctx->worker_id > shared->parties) {
+        fprintf(stderr, "fdchurn worker %d: no shared state (fdchurn_setup() not run)\n",
+                ctx->worker_id);
+        return -1;
+    }
+    fdchurn_state_t *fc = (fdchurn_state_t *)calloc(1, sizeof(fdchurn_state_t));
+    if (fc == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    fc->shared = shared;
+    fc->id = ctx->worker_id - 1;
+    barrier_local_init(&fc->local, fc->id);
+    ctx->state = fc;
+    return 0;
+}
+
+static int fdchurn_run_unit(worker_ctx_t *ctx) {
+    fdchurn_state_t *fc = (fdchurn_state_t *)ctx->state;
+    fd_kind_t kind = ctx->work->fd_kind;
+    long long ops = 0;
+
+    uint64_t t0 = timing_now();
+    for (int i = 0; i < ctx->work->fd_batch; i++) {
+        int n = 0;
+        if (kind == FD_KIND_FILE || kind == FD_KIND_MIX) {
+            n = churn_file();
+        }
+        if (n >= 0 && (kind == FD_KIND_PIPE || kind == FD_KIND_MIX)) {
+            int m = churn_pipe();
+            n = m < 0 ? -1 : n + m;
+        }
+        if (n >= 0 && (kind == FD_KIND_EVENTFD || kind == FD_KIND_MIX)) {
+            int m = churn_eventfd();
+            n = m < 0 ? -1 : n + m;
+        }
+        if (n < 0) {
+            return -1;
+        }
+        ops += n;
+    }
+    uint64_t t1 = timing_now();
+
+    fdchurn_slot_t *totals = &fc->totals;
+    if (totals->ops == 0) {
+        totals->first_tick = t0;
+    }
+    totals->last_tick = t1;
+    totals->ticks += t1 - t0;
+    totals->ops += ops;
+    return 0;
+}
+
+static void fdchurn_teardown(worker_ctx_t *ctx) {
+    free(ctx->state);
+    ctx->state = NULL;
+}
+
+/**
+ * fdchurn_print_result() - Aggregate call rate over all slots
+ */
+static void fdchurn_print_result(const char *tag, const fdchurn_shared_t *shared,
+                                 fd_kind_t kind) {
+    long long ops = 0;
+    uint64_t ticks = 0, first = UINT64_MAX, last = 0;
+    for (int i = 0; i < shared->parties; i++) {
+        const fdchurn_slot_t *slot = &shared->slots[i];
+        ops += slot->ops;
+        ticks += slot->ticks;
+        first = slot->first_tick < first ? slot->first_tick : first;
+        last = slot->last_tick > last ? slot->last_tick : last;
+    }
+    double wall_s = last > first ? timing_ticks_to_s(last - first) : 0.0;
+
+    cpu_set_t set;
+    int cpus = sched_getaffinity(0, sizeof(set), &set) == 0 ? CPU_COUNT(&set) : 1;
+
+    printf("[%s] FDCHURN_RESULT kind=%s workers=%d cpus=%d ops=%lld wall_s=%.3f "
+           "ops_per_s=%.0f ns_per_op=%.1f\n",
+           tag, fd_kind_name(kind), shared->parties, cpus, ops, wall_s,
+           wall_s > 0.0 ? ops / wall_s : 0.0, ops ? timing_ticks_to_ns(ticks) / ops : 0.0);
+    fflush(stdout);
+}
+
+static void fdchurn_report(const worker_ctx_t *ctx) {
+    fdchurn_state_t *fc = (fdchurn_state_t *)ctx->state;
+    const fdchurn_slot_t *totals = &fc->totals;
+    double busy_s = timing_ticks_to_s(totals->ticks);
+    printf("[%s] FDCHURN_STATS worker=%d batches=%d ops=%lld ops_per_s=%.0f ns_per_op=%.1f\n",
+           ctx->tag, ctx->worker_id, ctx->stats.units, totals->ops,
+           busy_s > 0.0 ? totals->ops / busy_s : 0.0,
+           totals->ops ? timing_ticks_to_ns(totals->ticks) / totals->ops : 0.0);
+    fflush(stdout);
+
+    // Publish, then one more barrier so worker 1 reads complete slots
+    fc->shared->slots[fc->id] = fc->totals;
+    barrier_wait(fc->shared->barrier, &fc->local);
+    if (fc->id == 0) {
+        fdchurn_print_result(ctx->tag, fc->shared, ctx->work->fd_kind);
+    }
+}
+
+const worker_ops_t fdchurn_worker_ops = {
+    WORKER_API_VERSION, "fdchurn", "one batch of descriptor open/dup/close cycles",
+    fdchurn_init, fdchurn_run_unit, fdchurn_teardown, fdchurn_report
+};
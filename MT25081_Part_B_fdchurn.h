@@ -0,0 +1,68 @@
+#ifndef FDCHURN_H
+#define FDCHURN_H
+
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_barrier.h"
+
+/**
+ * File-descriptor churn worker.
+ *
+ * One unit is work->fd_batch cycles of descriptor allocation and release
+ * of one kind (work->fd_kind):
+ *
+ *   file    - open("/dev/null"), dup(), close(), close()      4 calls
+ *   pipe    - pipe2(), close(), close()                       3 calls
+ *   eventfd - eventfd(), dup(), close(), close()              4 calls
+ *   mix     - one file, one pipe and one eventfd cycle       11 calls
+ *
+ * progB's threads allocate from one shared fd table (files_struct and its
+ * lock); progA's children each work on a private copy. After the last
+ * batch worker 1 prints a "[tag] FDCHURN_RESULT ..." line with the
+ * descriptor calls per second of all workers together (ops_per_s) and the
+ * mean latency of one call in one worker (ns_per_op).
+ */
+
+/**
+ * Per-worker totals, published to the shared region for FDCHURN_RESULT
+ */
+typedef struct {
+    long long ops;           // Descriptor system calls made
+    uint64_t ticks;          // Time in batches
+    uint64_t first_tick;     // Start of the first batch
+    uint64_t last_tick;      // End of the last batch
+} __attribute__((aligned(64))) fdchurn_slot_t;
+
+/**
+ * State shared by all workers of a run (MAP_SHARED, created before fork)
+ */
+typedef struct fdchurn_shared {
+    barrier_t *barrier;                        // Result barrier
+    int parties;                               // Number of workers
+    fdchurn_slot_t slots[BARRIER_MAX_PARTIES]; // Indexed by worker_id - 1
+} fdchurn_shared_t;
+
+/**
+ * Parse "file|pipe|eventfd|mix"; return -1 if unknown
+ */
+int fd_kind_parse(const char *name, fd_kind_t *kind);
+
+/**
+ * Name for the startup and result lines
+ */
+const char *fd_kind_name(fd_kind_t kind);
+
+/**
+ * Setup hook: maps the barrier and result slots for num_workers workers,
+ * stores them in work->fdchurn and prints the "[tag] FDCHURN" line. Must
+ * run before the workers start. Returns -1 (reason on stderr) on failure.
+ */
+int fdchurn_setup(work_params_t *work, int num_workers, const char *tag);
+
+/**
+ * Cleanup hook: unmaps the shared state from fdchurn_setup()
+ */
+void fdchurn_cleanup(work_params_t *work, const char *tag);
+
+extern const worker_ops_t fdchurn_worker_ops;
+
+#endif /* FDCHURN_H */
@@ -0,0 +1,368 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_imbalance.h"
+#include "MT25081_Part_B_timing.h"
+#include <math.h>
+#include <sys/mman.h>
+
+/**
+ *
+ * imbalance worker: skewed task costs under static, dynamic and guided
+ * scheduling (see imbalance.h).
+ *
+ * Every worker generates the same cost array from IMB_SEED in init, so
+ * only the claim counter and the result slots need shared memory. The
+ * round barrier is a futex barrier: a worker that ran out of tasks sleeps
+ * instead of spinning, so on an oversubscribed core its idle time does not
+ * steal CPU from the workers still running tasks.
+ *
+ * Like bsp, a round only means something across all N workers, so the
+ * worker needs imbalance_setup() (--target-seconds is refused for it).
+ * ============================================================================
+ */
+
+#define IMB_SEED 25081ULL                        // Task cost generator seed
+#define IMB_PARETO_SHAPE 1.5                     // Heavy tail, finite mean
+#define IMB_COST_CAP 1000                        // Max cost as a multiple of the mean
+#define IMB_MEM_BUFFER_BYTES (16UL * 1024 * 1024) // mem task sweep buffer per worker
+
+static const char *const dist_names[] = {"uniform", "exp", "pareto"};
+static const char *const schedule_names[] = {"static", "dynamic", "guided"};
+
+int task_dist_parse(const char *name, task_dist_t *dist) {
+    for (int d = 0; d < 3; d++) {
+        if (strcmp(name, dist_names[d]) == 0) {
+            *dist = (task_dist_t)d;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int schedule_parse(const char *spec, schedule_t *schedule, int *chunk) {
+    for (int s = 0; s < 3; s++) {
+        size_t len = strlen(schedule_names[s]);
+        if (strncmp(spec, schedule_names[s], len) != 0) {
+            continue;
+        }
+        if (spec[len] == '\0') {
+            *schedule = (schedule_t)s;
+            return 0;
+        }
+        if (spec[len] == ',' && atoi(spec + len + 1) >= 1) {
+            *schedule = (schedule_t)s;
+            *chunk = atoi(spec + len + 1);
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int task_kernel_parse(const char *name, task_kernel_t *kernel) {
+    if (strcmp(name, "cpu") == 0) {
+        *kernel = TASK_KERNEL_CPU;
+    } else if (strcmp(name, "mem") == 0) {
+        *kernel = TASK_KERNEL_MEM;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+const char *task_dist_name(task_dist_t dist) {
+    return dist_names[dist];
+}
+
+const char *schedule_name(schedule_t schedule) {
+    return schedule_names[schedule];
+}
+
+int imbalance_setup(work_params_t *work, int num_workers, const char *tag) {
+    imbalance_shared_t *shared = mmap(NULL, sizeof(imbalance_shared_t), PROT_READ | PROT_WRITE,
+                                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+    shared->barrier = barrier_create(BARRIER_FUTEX, num_workers);
+    if (shared->barrier == NULL) {
+        munmap(shared, sizeof(imbalance_shared_t));
+        return -1;
+    }
+    shared->parties = num_workers;
+    work->imbalance = shared;
+    printf("[%s] IMBALANCE dist=%s schedule=%s chunk=%d kernel=%s tasks=%d "
+           "task_cost=%d rounds=%d\n",
+           tag, task_dist_name(work->imb_dist), schedule_name(work->imb_schedule),
+           work->imb_chunk, work->imb_kernel == TASK_KERNEL_MEM ? "mem" : "cpu",
+           work->imb_tasks, work->imb_task_cost, work->imb_rounds);
+    return 0;
+}
+
+void imbalance_cleanup(work_params_t *work, const char *tag) {
+    (void)tag;
+    if (work->imbalance != NULL) {
+        barrier_free(work->imbalance->barrier);
+        munmap(work->imbalance, sizeof(imbalance_shared_t));
+        work->imbalance = NULL;
+    }
+}
+
+/**
+ * next_uniform() - xorshift64* step, returns a double in (0, 1]
+ */
+static double next_uniform(uint64_t *x) {
+    *x ^= *x >> 12;
+    *x ^= *x << 25;
+    *x ^= *x >> 27;
+    return (double)(((*x * 2685821657736338717ULL) >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * generate_costs() - Draws task costs with the given mean and distribution
+ */
+static void generate_costs(int *cost, int tasks, int mean, task_dist_t dist) {
+    uint64_t x = IMB_SEED;
+    double cap = (double)mean * IMB_COST_CAP;
+    for (int t = 0; t < tasks; t++) {
+        double u = next_uniform(&x);
+        double c;
+        switch (dist) {
+        case TASK_DIST_EXP:
+            c = -mean * log(u);
+            break;
+        case TASK_DIST_PARETO:
+            // Scale x_m = mean * (shape - 1) / shape gives the requested mean
+            c = mean * (IMB_PARETO_SHAPE - 1.0) / IMB_PARETO_SHAPE / pow(u, 1.0 / IMB_PARETO_SHAPE);
+            break;
+        default:
+            c = 2.0 * mean * u;
+            break;
+        }
+        cost[t] = (int)(c < cap ? c : cap);
+    }
+}
+
+/**
+ * thread_cpu_ns() - CPU time of the calling thread (or process, in progA)
+ */
+static uint64_t thread_cpu_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Per-worker state
+ */
+typedef struct {
+    imbalance_shared_t *shared;  // imbalance_setup()'s state
+    barrier_local_t local;
+    long *next;                  // Shared claim counter
+    int id;                      // 0..parties-1
+    int parties;
+    int tasks;
+    int *cost;                   // Cost of every task (same array in all workers)
+    int *buffer;                 // mem tasks: private sweep buffer
+    size_t buffer_ints;
+    int static_done;             // static: block already claimed this round
+    imbalance_slot_t totals;
+} imbalance_state_t;
+
+static int imbalance_init(worker_ctx_t *ctx) {
+    const work_params_t *work = ctx->work;
+    if (work->imbalance == NULL || ctx->worker_id < 1 ||
+        ctx->worker_id > work->imbalance->parties) {
+        fprintf(stderr, "imbalance worker %d: no shared state (imbalance_setup() not run)\n",
+                ctx->worker_id);
+        return -1;
+    }
+    imbalance_state_t *imb = (imbalance_state_t *)calloc(1, sizeof(imbalance_state_t));
+    if (imb == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    imb->tasks = work->imb_tasks;
+    imb->cost = (int *)malloc(imb->tasks * sizeof(int));
+    if (work->imb_kernel == TASK_KERNEL_MEM) {
+        imb->buffer_ints = IMB_MEM_BUFFER_BYTES / sizeof(int);
+        imb->buffer = (int *)calloc(imb->buffer_ints, sizeof(int));
+    }
+    if (imb->cost == NULL || (work->imb_kernel == TASK_KERNEL_MEM && imb->buffer == NULL)) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(imb->cost);
+        free(imb);
+        return -1;
+    }
+    generate_costs(imb->cost, imb->tasks, work->imb_task_cost, work->imb_dist);
+
+    imb->shared = work->imbalance;
+    imb->id = ctx->worker_id - 1;
+    imb->parties = imb->shared->parties;
+    imb->next = &imb->shared->next;
+    barrier_local_init(&imb->local, imb->id);
+    ctx->state = imb;
+    return 0;
+}
+
+/**
+ * claim() - Next range [*begin, *end) of tasks for this worker; 0 when done
+ */
+static int claim(imbalance_state_t *imb, const work_params_t *work, long *begin, long *end) {
+    long tasks = imb->tasks;
+    switch (work->imb_schedule) {
+    case SCHEDULE_STATIC:
+        // One contiguous block per worker, decided without communication
+        if (imb->static_done) {
+            return 0;
+        }
+        imb->static_done = 1;
+        *begin = tasks * imb->id / imb->parties;
+        *end = tasks * (imb->id + 1) / imb->parties;
+        return *begin < *end;
+    case SCHEDULE_DYNAMIC:
+        // Fixed-size chunks; the counter overshoots tasks once per worker
+        *begin = __atomic_fetch_add(imb->next, work->imb_chunk, __ATOMIC_RELAXED);
+        if (*begin >= tasks) {
+            return 0;
+        }
+        *end = *begin + work->imb_chunk < tasks ? *begin + work->imb_chunk : tasks;
+        return 1;
+    case SCHEDULE_GUIDED: {
+        // Chunk shrinks with the work left: remaining / N, at least imb_chunk
+        long cur = __atomic_load_n(imb->next, __ATOMIC_RELAXED);
+        long chunk;
+        do {
+            if (cur >= tasks) {
+                return 0;
+            }
+            chunk = (tasks - cur + imb->parties - 1) / imb->parties;
+            if (chunk < work->imb_chunk) {
+                chunk = work->imb_chunk;
+            }
+        } while (!__atomic_compare_exchange_n(imb->next, &cur, cur + chunk, 0,
+                                              __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+        *begin = cur;
+        *end = cur + chunk < tasks ? cur + chunk : tasks;
+        return 1;
+    }
+    }
+    return 0;
+}
+
+/**
+ * run_task() - cost Leibniz terms, or a write+read sweep over cost * 256 B
+ */
+static void run_task(const imbalance_state_t *imb, task_kernel_t kernel, int cost, int iter) {
+    if (kernel == TASK_KERNEL_CPU) {
+        double pi = leibniz_kernel(0.0, cost);
+        DO_NOT_OPTIMIZE(pi);
+        return;
+    }
+    // The sweeps touch one int per 256 bytes: cost * 64 ints, in buffer-sized pieces
+    size_t left = (size_t)cost * 64;
+    while (left > 0) {
+        size_t n = left < imb->buffer_ints ? left : imb->buffer_ints;
+        mem_write_sweep(imb->buffer, n, iter);
+        int sum = mem_read_sweep(imb->buffer, n);
+        DO_NOT_OPTIMIZE(sum);
+        left -= n;
+    }
+}
+
+static int imbalance_run_unit(worker_ctx_t *ctx) {
+    imbalance_state_t *imb = (imbalance_state_t *)ctx->state;
+    const work_params_t *work = ctx->work;
+
+    // START: every worker enters the round together
+    barrier_wait(imb->shared->barrier, &imb->local);
+    uint64_t t0 = timing_now();
+
+    // TASK PHASE: claim and run ranges until the task set is exhausted
+    long begin, end;
+    imb->static_done = 0;
+    while (claim(imb, work, &begin, &end)) {
+        uint64_t cpu0 = thread_cpu_ns();
+        for (long t = begin; t < end; t++) {
+            run_task(imb, work->imb_kernel, imb->cost[t], imb->totals.tasks);
+        }
+        imb->totals.busy_ns += thread_cpu_ns() - cpu0;
+        imb->totals.tasks += (int)(end - begin);
+        imb->totals.chunks++;
+    }
+
+    // END: idle until the slowest worker finishes the round
+    uint64_t t1 = timing_now();
+    barrier_wait(imb->shared->barrier, &imb->local);
+    uint64_t t2 = timing_now();
+    imb->totals.idle_ticks += t2 - t1;
+    imb->totals.span_ticks += t2 - t0;
+
+    // Everyone else waits in the next start barrier until worker 1 arrives
+    if (imb->id == 0) {
+        __atomic_store_n(imb->next, 0, __ATOMIC_RELAXED);
+    }
+    return 0;
+}
+
+static void imbalance_teardown(worker_ctx_t *ctx) {
+    imbalance_state_t *imb = (imbalance_state_t *)ctx->state;
+    free(imb->buffer);
+    free(imb->cost);
+    free(imb);
+    ctx->state = NULL;
+}
+
+/**
+ * imbalance_print_result() - Makespan, idle time and Jain's index over slots
+ */
+static void imbalance_print_result(const char *tag, const imbalance_shared_t *shared,
+                                   const work_params_t *work, int rounds) {
+    double busy_sum = 0.0, busy_sq = 0.0, idle_sum = 0.0, idle_max = 0.0, span_max = 0.0;
+    for (int i = 0; i < shared->parties; i++) {
+        const imbalance_slot_t *slot = &shared->slots[i];
+        double busy = (double)slot->busy_ns;
+        double idle = timing_ticks_to_ns(slot->idle_ticks);
+        double span = timing_ticks_to_ns(slot->span_ticks);
+        busy_sum += busy;
+        busy_sq += busy * busy;
+        idle_sum += idle;
+        idle_max = idle > idle_max ? idle : idle_max;
+        span_max = span > span_max ? span : span_max;
+    }
+    int n = shared->parties;
+    double jain = busy_sq > 0.0 ? busy_sum * busy_sum / (n * busy_sq) : 1.0;
+    double per_round_ms = 1e-6 / rounds;
+    printf("[%s] IMBALANCE_RESULT dist=%s schedule=%s chunk=%d kernel=%s workers=%d "
+           "tasks=%d task_cost=%d rounds=%d makespan_ms=%.3f idle_mean_ms=%.3f "
+           "idle_max_ms=%.3f idle_pct=%.2f jain=%.4f\n",
+           tag, task_dist_name(work->imb_dist), schedule_name(work->imb_schedule),
+           work->imb_chunk, work->imb_kernel == TASK_KERNEL_MEM ? "mem" : "cpu", n,
+           work->imb_tasks, work->imb_task_cost, rounds, span_max * per_round_ms,
+           idle_sum / n * per_round_ms, idle_max * per_round_ms,
+           span_max > 0.0 ? 100.0 * idle_sum / n / span_max : 0.0, jain);
+    fflush(stdout);
+}
+
+static void imbalance_report(const worker_ctx_t *ctx) {
+    imbalance_state_t *imb = (imbalance_state_t *)ctx->state;
+    const imbalance_slot_t *totals = &imb->totals;
+    double span_ns = timing_ticks_to_ns(totals->span_ticks);
+    double idle_ns = timing_ticks_to_ns(totals->idle_ticks);
+    printf("[%s] IMBALANCE_STATS worker=%d tasks=%d chunks=%d busy_ms=%.3f idle_ms=%.3f "
+           "span_ms=%.3f idle_pct=%.2f\n",
+           ctx->tag, ctx->worker_id, totals->tasks, totals->chunks, totals->busy_ns * 1e-6,
+           idle_ns * 1e-6, span_ns * 1e-6, span_ns > 0.0 ? 100.0 * idle_ns / span_ns : 0.0);
+    fflush(stdout);
+
+    // Publish, then one more barrier so worker 1 reads complete slots
+    imb->shared->slots[imb->id] = imb->totals;
+    barrier_wait(imb->shared->barrier, &imb->local);
+    if (imb->id == 0) {
+        imbalance_print_result(ctx->tag, imb->shared, ctx->work, ctx->stats.units);
+    }
+}
+
+const worker_ops_t imbalance_worker_ops = {
+    WORKER_API_VERSION, "imbalance", "one round over the skewed task set",
+    imbalance_init, imbalance_run_unit, imbalance_teardown, imbalance_report
+};
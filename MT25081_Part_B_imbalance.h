@@ -0,0 +1,77 @@
+#ifndef IMBALANCE_H
+#define IMBALANCE_H
+
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_barrier.h"
+
+/**
+ * Load-imbalance worker.
+ *
+ * The parent generates work->imb_tasks tasks with costs drawn from
+ * work->imb_dist (fixed seed, so every run and every round sees the same
+ * costs) and the N workers split them with work->imb_schedule. One unit is
+ * a round over the whole task set between a start and an end barrier:
+ *
+ *   busy - CPU time (CLOCK_THREAD_CPUTIME_ID) spent running tasks
+ *   idle - wall time spent in the end barrier, waiting for the last worker
+ *
+ * After the last round worker 1 prints a "[tag] IMBALANCE_RESULT ..." line:
+ * makespan (mean round time of the slowest worker), mean/max idle time and
+ * Jain's fairness index of busy time, (sum b)^2 / (N * sum b^2), which is
+ * 1.0 when every worker did the same work and 1/N when one did all of it.
+ *
+ * The dynamic/guided counter is in MAP_SHARED memory, so progA's processes
+ * self-schedule through the same atomic counter as progB's threads.
+ */
+
+/**
+ * Per-worker totals, published to the shared region for IMBALANCE_RESULT
+ */
+typedef struct {
+    int tasks;               // Tasks run, over all rounds
+    int chunks;              // Counter claims that returned work
+    uint64_t busy_ns;        // CPU time in tasks
+    uint64_t idle_ticks;     // Wall time in the end-of-round barrier
+    uint64_t span_ticks;     // Wall time from start to end barrier, summed
+} __attribute__((aligned(64))) imbalance_slot_t;
+
+/**
+ * State shared by all workers of a run (created before fork)
+ */
+typedef struct imbalance_shared {
+    barrier_t *barrier;                          // Round start/end barrier
+    int parties;                                 // Number of workers
+    long next __attribute__((aligned(64)));      // dynamic/guided: next unclaimed task
+    imbalance_slot_t slots[BARRIER_MAX_PARTIES]; // Indexed by worker_id - 1
+} imbalance_shared_t;
+
+/**
+ * Parse "uniform|exp|pareto", "static|dynamic|guided[,chunk]" and
+ * "cpu|mem"; return -1 if unknown
+ */
+int task_dist_parse(const char *name, task_dist_t *dist);
+int schedule_parse(const char *spec, schedule_t *schedule, int *chunk);
+int task_kernel_parse(const char *name, task_kernel_t *kernel);
+
+/**
+ * Names for the startup and result lines
+ */
+const char *task_dist_name(task_dist_t dist);
+const char *schedule_name(schedule_t schedule);
+
+/**
+ * Setup hook: maps the counter, barrier and result slots for num_workers
+ * workers, stores them in work->imbalance and prints the "[tag] IMBALANCE"
+ * line. Must run before the workers start.
+ * Returns -1 (reason on stderr) on failure.
+ */
+int imbalance_setup(work_params_t *work, int num_workers, const char *tag);
+
+/**
+ * Cleanup hook: unmaps the shared state from imbalance_setup()
+ */
+void imbalance_cleanup(work_params_t *work, const char *tag);
+
+extern const worker_ops_t imbalance_worker_ops;
+
+#endif /* IMBALANCE_H */
@@ -0,0 +1,55 @@
+#include <cstdint>
+#include <cstring>
+#include "MT25081_Part_B_kernels.hpp"
+
+/**
+ *
+ * extern "C" shim over the templated kernels.
+ *
+ * The variant table is a constexpr array: every entry is built at compile
+ * time and points at an explicit instantiation of a template in
+ * MT25081_Part_B_kernels.hpp. Adding a combination is one line here.
+ *
+ * Naming: <kind>_<elem>[_s<stride bytes>]_u<unroll>
+ * ============================================================================
+ */
+
+using namespace pa01;
+
+static constexpr tkernel_t variants[] = {
+    // cpu: Leibniz series, float vs double, 1/2/4/8 accumulators
+    cpu_variant<double, 1>("cpu_f64_u1", "f64"),
+    cpu_variant<double, 2>("cpu_f64_u2", "f64"),
+    cpu_variant<double, 4>("cpu_f64_u4", "f64"),
+    cpu_variant<double, 8>("cpu_f64_u8", "f64"),
+    cpu_variant<float, 1>("cpu_f32_u1", "f32"),
+    cpu_variant<float, 4>("cpu_f32_u4", "f32"),
+    cpu_variant<float, 8>("cpu_f32_u8", "f32"),
+
+    // mem: int32 vs int64 arrays, 64 B (every line) vs 256 B (C kernel) stride
+    mem_variant<std::int32_t, 256, 1>("mem_i32_s256_u1", "i32"),
+    mem_variant<std::int32_t, 256, 4>("mem_i32_s256_u4", "i32"),
+    mem_variant<std::int32_t, 64, 4>("mem_i32_s64_u4", "i32"),
+    mem_variant<std::int64_t, 256, 1>("mem_i64_s256_u1", "i64"),
+    mem_variant<std::int64_t, 256, 4>("mem_i64_s256_u4", "i64"),
+    mem_variant<std::int64_t, 64, 4>("mem_i64_s64_u4", "i64"),
+};
+
+static constexpr int num_variants = (int)(sizeof(variants) / sizeof(variants[0]));
+
+extern "C" int tkernel_count(void) {
+    return num_variants;
+}
+
+extern "C" const tkernel_t *tkernel_get(int i) {
+    return (i >= 0 && i < num_variants) ? &variants[i] : nullptr;
+}
+
+extern "C" const tkernel_t *tkernel_find(const char *name) {
+    for (int i = 0; i < num_variants; i++) {
+        if (std::strcmp(variants[i].name, name) == 0) {
+            return &variants[i];
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,57 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Templated kernel variants (C view).
+ *
+ * MT25081_Part_B_kernels.hpp defines the cpu and mem kernels as C++17
+ * templates over element type, unroll factor and stride. The shim
+ * (MT25081_Part_B_kernels.cpp) instantiates a fixed set of them into a
+ * constexpr table of tkernel_t entries, and the functions below expose that
+ * table to the C drivers. Each entry points to a fully specialized
+ * instantiation, so picking a variant costs one table lookup at startup
+ * and no branches inside the kernel.
+ */
+
+/**
+ * One compiled kernel variant. cpu variants set cpu; mem variants set
+ * mem_write and mem_read (the other pointers are NULL).
+ */
+typedef struct {
+    const char *name;          // e.g. "cpu_f32_u4", "mem_i64_s64_u4"
+    const char *kind;          // "cpu" or "mem"
+    const char *elem;          // Element type: "f32", "f64", "i32", "i64"
+    int elem_bytes;            // sizeof(element)
+    int unroll;                // Independent accumulators / stores per step
+    int stride_bytes;          // mem: write stride (reads use 4x); cpu: 0
+    double (*cpu)(int terms);                                  // Leibniz terms
+    void (*mem_write)(void *array, size_t bytes, int iter);    // Strided write sweep
+    long long (*mem_read)(const void *array, size_t bytes);    // Strided read sweep
+} tkernel_t;
+
+/**
+ * Number of variants in the table
+ */
+int tkernel_count(void);
+
+/**
+ * Variant at index i (0 <= i < tkernel_count()), or NULL
+ */
+const tkernel_t *tkernel_get(int i);
+
+/**
+ * Variant by name, or NULL if unknown
+ */
+const tkernel_t *tkernel_find(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KERNELS_H */
@@ -0,0 +1,126 @@
+#ifndef KERNELS_HPP
+#define KERNELS_HPP
+
+#include <cstddef>
+#include <utility>
+#include "MT25081_Part_B_kernels.h"
+
+/**
+ * Header-only templated cpu/mem kernels (C++17).
+ *
+ * Same work as the C kernels in MT25081_Part_B_workers.c, with the layout
+ * and type choices lifted into template parameters:
+ *   - T:           element / accumulator type (float, double, int32, int64)
+ *   - Unroll:      independent accumulators (cpu, mem read) or stores per
+ *                  step (mem write); expanded with a fold expression, so
+ *                  the unrolled body exists at compile time, not as a loop
+ *   - StrideBytes: distance between touched elements of a mem write sweep;
+ *                  the read sweep uses 4x, as the C kernels do (256 B / 1 KB)
+ *
+ * Kernels take and return plain types so the shim can store pointers to
+ * their instantiations in the C-visible tkernel_t table (see kernels.h).
+ */
+
+namespace pa01 {
+
+/**
+ * leibniz() - Sums terms [0, terms) of the Leibniz series in T
+ *
+ * Even/odd terms are paired, and the pairs are spread over Unroll
+ * accumulators to break the floating-point add dependency chain.
+ */
+template <typename T, int Unroll, std::size_t... U>
+inline void leibniz_step(T (&acc)[Unroll], int i, std::index_sequence<U...>) {
+    ((acc[U] += T(1) / T(2 * (i + 2 * (int)U) + 1) - T(1) / T(2 * (i + 2 * (int)U) + 3)), ...);
+}
+
+template <typename T, int Unroll>
+double leibniz(int terms) {
+    static_assert(Unroll >= 1, "Unroll must be at least 1");
+    T acc[Unroll] = {};
+    int i = 0;
+    for (; i + 2 * Unroll <= terms; i += 2 * Unroll) {
+        leibniz_step<T, Unroll>(acc, i, std::make_index_sequence<Unroll>{});
+    }
+    T sum = T(0);
+    for (int u = 0; u < Unroll; u++) {
+        sum += acc[u];
+    }
+    for (; i < terms; i++) {
+        sum += (i % 2 == 0 ? T(1) : T(-1)) / T(2 * i + 1);  // Remainder terms
+    }
+    return (double)sum;
+}
+
+/**
+ * write_sweep() - Writes one T every StrideBytes bytes
+ */
+template <typename T, int StrideBytes, std::size_t... U>
+inline void write_step(T *a, std::size_t i, int iter, std::index_sequence<U...>) {
+    constexpr std::size_t step = StrideBytes / sizeof(T);
+    ((a[i + U * step] = T(i + U * step + iter)), ...);
+}
+
+template <typename T, int StrideBytes, int Unroll>
+void write_sweep(void *array, std::size_t bytes, int iter) {
+    constexpr std::size_t step = StrideBytes / sizeof(T);
+    static_assert(step >= 1, "StrideBytes must be at least sizeof(T)");
+    T *a = static_cast<T *>(array);
+    const std::size_t n = bytes / sizeof(T);
+    std::size_t i = 0;
+    for (; i + step * Unroll <= n; i += step * Unroll) {
+        write_step<T, StrideBytes>(a, i, iter, std::make_index_sequence<Unroll>{});
+    }
+    for (; i < n; i += step) {
+        a[i] = T(i + iter);
+    }
+}
+
+/**
+ * read_sweep() - Sums one T every 4 * StrideBytes bytes into Unroll accumulators
+ */
+template <typename T, int StrideBytes, int Unroll, std::size_t... U>
+inline void read_step(T (&acc)[Unroll], const T *a, std::size_t i, std::index_sequence<U...>) {
+    constexpr std::size_t step = 4 * StrideBytes / sizeof(T);
+    ((acc[U] += a[i + U * step]), ...);
+}
+
+template <typename T, int StrideBytes, int Unroll>
+long long read_sweep(const void *array, std::size_t bytes) {
+    constexpr std::size_t step = 4 * StrideBytes / sizeof(T);
+    const T *a = static_cast<const T *>(array);
+    const std::size_t n = bytes / sizeof(T);
+    T acc[Unroll] = {};
+    std::size_t i = 0;
+    for (; i + step * Unroll <= n; i += step * Unroll) {
+        read_step<T, StrideBytes, Unroll>(acc, a, i, std::make_index_sequence<Unroll>{});
+    }
+    T sum = T(0);
+    for (int u = 0; u < Unroll; u++) {
+        sum += acc[u];
+    }
+    for (; i < n; i += step) {
+        sum += a[i];
+    }
+    return (long long)sum;
+}
+
+/**
+ * Table entry builders: one fully specialized instantiation per entry
+ */
+template <typename T, int Unroll>
+constexpr tkernel_t cpu_variant(const char *name, const char *elem) {
+    return tkernel_t{name, "cpu", elem, (int)sizeof(T), Unroll, 0,
+                     &leibniz<T, Unroll>, nullptr, nullptr};
+}
+
+template <typename T, int StrideBytes, int Unroll>
+constexpr tkernel_t mem_variant(const char *name, const char *elem) {
+    return tkernel_t{name, "mem", elem, (int)sizeof(T), Unroll, StrideBytes,
+                     nullptr, &write_sweep<T, StrideBytes, Unroll>,
+                     &read_sweep<T, StrideBytes, Unroll>};
+}
+
+}  // namespace pa01
+
+#endif /* KERNELS_HPP */
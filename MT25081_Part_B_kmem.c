@@ -0,0 +1,139 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_kmem.h"
+#include "MT25081_Part_B_metrics.h"
+#include <errno.h>
+#include <sys/mman.h>
+
+/**
+ *
+ * Kernel memory per worker (see kmem.h) and the idle worker.
+ *
+ * slabinfo counts objects per cache, not pages, so a delta below one slab
+ * is still visible; meminfo's Slab moves in whole slabs and per-CPU
+ * caches may absorb a few objects, which is why both are reported.
+ * ============================================================================
+ */
+
+static const char *const cache_names[KMEM_CACHES] = {
+    "task_struct", "mm_struct", "vm_area_struct", "files_cache",
+    "signal_cache", "sighand_cache", "pid", "anon_vma"
+};
+
+kmem_account_t *kmem_create(int num_workers) {
+    kmem_account_t *acct = mmap(NULL, sizeof(kmem_account_t), PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (acct == MAP_FAILED) {
+        perror("mmap");
+        return NULL;
+    }
+    acct->barrier = barrier_create(BARRIER_FUTEX, num_workers);
+    if (acct->barrier == NULL) {
+        munmap(acct, sizeof(kmem_account_t));
+        return NULL;
+    }
+    acct->parties = num_workers;
+    return acct;
+}
+
+void kmem_free(kmem_account_t *acct) {
+    if (acct != NULL) {
+        barrier_free(acct->barrier);
+        munmap(acct, sizeof(kmem_account_t));
+    }
+}
+
+/**
+ * slabinfo_read() - Sums /proc/slabinfo and picks out the reported caches:
+ *   name <active_objs> <num_objs> <objsize> <objperslab> <pagesperslab> : ...
+ */
+static void slabinfo_read(kmem_snapshot_t *snap) {
+    FILE *fp = fopen("/proc/slabinfo", "r");
+    if (fp == NULL) {
+        return;
+    }
+
+    char line[512];
+    char name[64];
+    long long active, total, objsize;
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (sscanf(line, "%63s %lld %lld %lld", name, &active, &total, &objsize) != 4) {
+            continue;   // Version and header lines
+        }
+        snap->slabinfo_bytes += active * objsize;
+        for (int c = 0; c < KMEM_CACHES; c++) {
+            if (strcmp(name, cache_names[c]) == 0) {
+                snap->cache_objs[c] = active;
+                snap->cache_objsize[c] = objsize;
+            }
+        }
+        snap->slabinfo_valid = 1;
+    }
+    fclose(fp);
+}
+
+void kmem_snapshot(kmem_snapshot_t *snap) {
+    memset(snap, 0, sizeof(*snap));
+    snap->page_tables_kb = meminfo_read_kb("PageTables");
+    snap->kernel_stack_kb = meminfo_read_kb("KernelStack");
+    snap->slab_kb = meminfo_read_kb("Slab");
+    snap->sunreclaim_kb = meminfo_read_kb("SUnreclaim");
+    slabinfo_read(snap);
+}
+
+void kmem_sample(kmem_account_t *acct, int worker_id) {
+    barrier_local_t local;
+    barrier_local_init(&local, worker_id - 1);
+
+    // All N workers exist; they sleep in the barrier while worker 1 reads
+    barrier_wait(acct->barrier, &local);
+    if (worker_id == 1) {
+        kmem_snapshot(&acct->after);
+    }
+    barrier_wait(acct->barrier, &local);
+}
+
+void kmem_report(const char *tag, const kmem_account_t *acct) {
+    const kmem_snapshot_t *b = &acct->before;
+    const kmem_snapshot_t *a = &acct->after;
+    int n = acct->parties;
+
+    int slabinfo = b->slabinfo_valid && a->slabinfo_valid;
+    if (slabinfo) {
+        for (int c = 0; c < KMEM_CACHES; c++) {
+            long long objs = a->cache_objs[c] - b->cache_objs[c];
+            printf("[%s] KMEM_SLAB cache=%s objs=%lld kb=%.1f per_worker_objs=%.2f\n",
+                   tag, cache_names[c], objs, objs * a->cache_objsize[c] / 1024.0,
+                   (double)objs / n);
+        }
+    }
+
+    long long page_tables = a->page_tables_kb - b->page_tables_kb;
+    long long kernel_stack = a->kernel_stack_kb - b->kernel_stack_kb;
+    long long slab = a->slab_kb - b->slab_kb;
+    long long total = page_tables + kernel_stack + slab;
+    printf("[%s] KMEM_RESULT workers=%d page_tables_kb=%lld kernel_stack_kb=%lld slab_kb=%lld "
+           "sunreclaim_kb=%lld total_kb=%lld per_worker_kb=%.1f slabinfo_kb=%.1f\n",
+           tag, n, page_tables, kernel_stack, slab, a->sunreclaim_kb - b->sunreclaim_kb,
+           total, (double)total / n,
+           slabinfo ? (a->slabinfo_bytes - b->slabinfo_bytes) / 1024.0 : -1.0);
+    fflush(stdout);
+}
+
+/* ============================== idle worker ============================== */
+
+static int idle_run_unit(worker_ctx_t *ctx) {
+    int ms = ctx->work->idle_ms;
+    struct timespec ts = {ms / 1000, (long)(ms % 1000) * 1000000L};
+    while (nanosleep(&ts, &ts) != 0) {
+        if (errno != EINTR) {
+            perror("nanosleep");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+const worker_ops_t idle_worker_ops = {
+    WORKER_API_VERSION, "idle", "one sleep of --idle-ms milliseconds",
+    NULL, idle_run_unit, NULL, NULL
+};
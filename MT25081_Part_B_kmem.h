@@ -0,0 +1,89 @@
+#ifndef KMEM_H
+#define KMEM_H
+
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_barrier.h"
+
+/**
+ * Kernel-side memory cost of the workers themselves (--kmem).
+ *
+ * The driver snapshots /proc/meminfo (PageTables, KernelStack, Slab,
+ * SUnreclaim) and, where readable (root), /proc/slabinfo just before it
+ * starts the workers. Every worker calls kmem_sample() right after its
+ * init: once all N exist and wait at a barrier, worker 1 takes the second
+ * snapshot. The difference is what N processes, threads or a hybrid of
+ * both cost the kernel (task_struct, kernel stacks, mm_struct and page
+ * tables, VMAs, fd tables, signal structures, ...). After the backend
+ * returns the driver prints:
+ *
+ *   [tag] KMEM_SLAB cache=task_struct objs=... kb=... per_worker_objs=...
+ *   [tag] KMEM_RESULT workers=N page_tables_kb=... kernel_stack_kb=...
+ *         slab_kb=... sunreclaim_kb=... total_kb=... per_worker_kb=...
+ *         slabinfo_kb=...          (-1 if /proc/slabinfo is unreadable)
+ *
+ * The counters are system-wide, so other activity on the host shows up as
+ * noise; the per-worker slope over several N (MT25081_Part_D_kmem.sh) is
+ * more reliable than one run. The "idle" worker below does nothing but
+ * sleep, so no user-space allocation adds to the page tables.
+ */
+
+#define KMEM_CACHES 8   // slabinfo caches reported individually
+
+/**
+ * One snapshot of the kernel memory counters
+ */
+typedef struct {
+    long long page_tables_kb;              // /proc/meminfo PageTables
+    long long kernel_stack_kb;             // KernelStack
+    long long slab_kb;                     // Slab
+    long long sunreclaim_kb;               // SUnreclaim
+    int slabinfo_valid;                    // 1 if /proc/slabinfo was readable
+    long long slabinfo_bytes;              // Sum of active_objs * objsize
+    long long cache_objs[KMEM_CACHES];     // Active objects per reported cache
+    long long cache_objsize[KMEM_CACHES];  // Object size per reported cache
+} kmem_snapshot_t;
+
+/**
+ * State shared by the driver and all workers (MAP_SHARED, created before fork)
+ */
+typedef struct kmem_account {
+    barrier_t *barrier;      // All-workers-started barrier
+    int parties;             // Number of workers
+    kmem_snapshot_t before;  // Taken by the driver before the workers start
+    kmem_snapshot_t after;   // Taken by worker 1 with all workers alive
+} kmem_account_t;
+
+/**
+ * Maps the shared state for num_workers workers.
+ * Returns NULL (reason on stderr) on failure.
+ */
+kmem_account_t *kmem_create(int num_workers);
+
+/**
+ * Reads the counters into snap
+ */
+void kmem_snapshot(kmem_snapshot_t *snap);
+
+/**
+ * Worker side: waits until all workers exist, worker 1 takes the "after"
+ * snapshot, then all continue. Every worker must call it exactly once,
+ * even if its init failed.
+ */
+void kmem_sample(kmem_account_t *acct, int worker_id);
+
+/**
+ * Prints the KMEM_SLAB and KMEM_RESULT lines
+ */
+void kmem_report(const char *tag, const kmem_account_t *acct);
+
+/**
+ * Unmaps the state from kmem_create()
+ */
+void kmem_free(kmem_account_t *acct);
+
+/**
+ * Worker that only sleeps: one unit is one nanosleep() of work->idle_ms
+ */
+extern const worker_ops_t idle_worker_ops;
+
+#endif /* KMEM_H */
@@ -0,0 +1,216 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_latency.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+/**
+ *
+ * Wakeup latency probe thread (see latency.h).
+ *
+ * The thread applies its own policy and CPU before the first sample and
+ * reports the outcome through a semaphore, so latency_probe_start() can
+ * fail cleanly (e.g. EPERM for fifo without CAP_SYS_NICE) and no sample is
+ * taken under the inherited policy. A deadline missed by more than a period
+ * is not replayed: the next deadline is the first period boundary after
+ * the wakeup, as in cyclictest.
+ * ============================================================================
+ */
+
+static const char *const policy_names[] = {"other", "fifo", "rr", "batch", "idle"};
+static const int policy_values[] = {SCHED_OTHER, SCHED_FIFO, SCHED_RR, SCHED_BATCH, SCHED_IDLE};
+
+/**
+ * Probe state (one probe per driver process)
+ */
+static struct {
+    latency_params_t params;
+    pthread_t thread;
+    int running;
+    int stop;                              // Set by latency_probe_stop()
+    int error;                             // Setup errno reported by the thread
+    sem_t ready;
+    long long samples;
+    long long sum_ns;
+    long long min_ns;
+    long long max_ns;
+    long long hist[LATENCY_HIST_US + 1];   // Last bucket: overflow
+} probe;
+
+int latency_policy_parse(const char *name, int *policy) {
+    for (int i = 0; i < 5; i++) {
+        if (strcmp(name, policy_names[i]) == 0) {
+            *policy = policy_values[i];
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *latency_policy_name(int policy) {
+    for (int i = 0; i < 5; i++) {
+        if (policy_values[i] == policy) {
+            return policy_names[i];
+        }
+    }
+    return "unknown";
+}
+
+/**
+ * timespec_ns() - A timespec as nanoseconds
+ */
+static long long timespec_ns(const struct timespec *ts) {
+    return (long long)ts->tv_sec * 1000000000LL + ts->tv_nsec;
+}
+
+/**
+ * probe_record() - Adds one wakeup latency to the histogram
+ */
+static void probe_record(long long late_ns) {
+    long long us = late_ns / 1000;
+    probe.hist[us < LATENCY_HIST_US ? us : LATENCY_HIST_US]++;
+    if (probe.samples == 0 || late_ns < probe.min_ns) {
+        probe.min_ns = late_ns;
+    }
+    if (late_ns > probe.max_ns) {
+        probe.max_ns = late_ns;
+    }
+    probe.sum_ns += late_ns;
+    probe.samples++;
+}
+
+static void *probe_thread(void *arg) {
+    (void)arg;
+    const latency_params_t *params = &probe.params;
+
+    // SETUP: own policy and CPU, then tell latency_probe_start() the outcome
+    struct sched_param sp;
+    memset(&sp, 0, sizeof(sp));
+    if (params->policy == SCHED_FIFO || params->policy == SCHED_RR) {
+        sp.sched_priority = params->priority;
+    }
+    int rc = pthread_setschedparam(pthread_self(), params->policy, &sp);
+    if (rc == 0 && params->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(params->cpu, &set);
+        rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+    probe.error = rc;
+    sem_post(&probe.ready);
+    if (rc != 0) {
+        return NULL;
+    }
+
+    // MEASUREMENT: sleep to absolute deadlines, record how late we woke up
+    long long period_ns = (long long)params->period_us * 1000LL;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    long long next = timespec_ns(&now);
+    while (!__atomic_load_n(&probe.stop, __ATOMIC_RELAXED)) {
+        next += period_ns;
+        struct timespec deadline = {(time_t)(next / 1000000000LL), (long)(next % 1000000000LL)};
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+        }
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long long wake = timespec_ns(&now);
+        probe_record(wake - next);
+        while (next + period_ns <= wake) {
+            next += period_ns;
+        }
+    }
+    return NULL;
+}
+
+int latency_probe_start(const latency_params_t *params) {
+    if (params->period_us <= 0) {
+        return 0;
+    }
+    memset(&probe, 0, sizeof(probe));
+    probe.params = *params;
+    sem_init(&probe.ready, 0, 0);
+    int rc = pthread_create(&probe.thread, NULL, probe_thread, NULL);
+    if (rc != 0) {
+        fprintf(stderr, "Error: cannot create latency probe thread: %s\n", strerror(rc));
+        sem_destroy(&probe.ready);
+        return -1;
+    }
+    while (sem_wait(&probe.ready) != 0) {
+    }
+    if (probe.error != 0) {
+        pthread_join(probe.thread, NULL);
+        sem_destroy(&probe.ready);
+        fprintf(stderr, "Error: cannot run latency probe as %s priority %d on CPU %d: %s\n",
+                latency_policy_name(params->policy), params->priority, params->cpu,
+                strerror(probe.error));
+        return -1;
+    }
+    probe.running = 1;
+    return 0;
+}
+
+/**
+ * probe_percentile_us() - Bucket holding the q-quantile (max_us if it overflowed)
+ */
+static double probe_percentile_us(double q) {
+    long long rank = (long long)(q * probe.samples);
+    if (rank >= probe.samples) {
+        rank = probe.samples - 1;
+    }
+    long long seen = 0;
+    for (int us = 0; us < LATENCY_HIST_US; us++) {
+        seen += probe.hist[us];
+        if (seen > rank) {
+            return us;
+        }
+    }
+    return probe.max_ns / 1000.0;
+}
+
+/**
+ * probe_write_hist() - Non-empty buckets as "latency_us,count" rows
+ */
+static void probe_write_hist(const char *path) {
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) {
+        perror(path);
+        return;
+    }
+    fprintf(fp, "latency_us,count\n");
+    for (int us = 0; us <= LATENCY_HIST_US; us++) {
+        if (probe.hist[us] != 0) {
+            fprintf(fp, "%d,%lld\n", us, probe.hist[us]);
+        }
+    }
+    fclose(fp);
+}
+
+void latency_probe_stop(const char *tag) {
+    if (!probe.running) {
+        return;
+    }
+    __atomic_store_n(&probe.stop, 1, __ATOMIC_RELAXED);
+    pthread_join(probe.thread, NULL);
+    sem_destroy(&probe.ready);
+    probe.running = 0;
+
+    const latency_params_t *params = &probe.params;
+    long long n = probe.samples;
+    printf("[%s] LATENCY_RESULT policy=%s priority=%d period_us=%d samples=%lld "
+           "min_us=%.1f avg_us=%.1f p50_us=%.0f p99_us=%.0f p999_us=%.0f max_us=%.1f "
+           "overflows=%lld\n",
+           tag, latency_policy_name(params->policy), params->priority, params->period_us, n,
+           n ? probe.min_ns / 1000.0 : 0.0, n ? probe.sum_ns / 1000.0 / n : 0.0,
+           n ? probe_percentile_us(0.50) : 0.0, n ? probe_percentile_us(0.99) : 0.0,
+           n ? probe_percentile_us(0.999) : 0.0, probe.max_ns / 1000.0,
+           probe.hist[LATENCY_HIST_US]);
+    fflush(stdout);
+    if (params->hist_path != NULL) {
+        probe_write_hist(params->hist_path);
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+/**
+ * Timer wakeup latency probe (cyclictest-style).
+ *
+ * While the backend runs the N workers, one extra thread in the driver
+ * process sleeps until absolute deadlines every period_us with
+ * clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME) and records how late it
+ * woke up in a histogram of 1 us buckets. It runs under its own scheduling
+ * policy, and on the same CPUs as the workers unless taskset/--probe-cpu
+ * says otherwise, so the result is the latency a timer sees next to the
+ * background load. At the end the driver prints one line:
+ *
+ *   [tag] LATENCY_RESULT policy=fifo priority=80 period_us=1000 samples=...
+ *         min_us=... avg_us=... p50_us=... p99_us=... p999_us=... max_us=...
+ *         overflows=...
+ *
+ * Latencies of LATENCY_HIST_US or more land in the overflow bucket; max_us
+ * is still exact.
+ */
+
+#define LATENCY_HIST_US 10000     // Histogram range, 1 us buckets
+#define LATENCY_FIFO_PRIORITY 80  // Default priority for fifo/rr probes
+
+/**
+ * Probe options (--latency-probe, --probe-policy, --probe-priority,
+ * --probe-cpu, --latency-hist); all-zero means no probe
+ */
+typedef struct {
+    int period_us;           // Wakeup period, 0 = probe disabled
+    int policy;              // SCHED_OTHER, SCHED_FIFO, SCHED_RR, SCHED_BATCH, SCHED_IDLE
+    int priority;            // sched_priority for fifo/rr
+    int cpu;                 // CPU to pin the probe to, -1 = inherit the affinity mask
+    const char *hist_path;   // Write "latency_us,count" rows here, NULL = none
+} latency_params_t;
+
+/**
+ * Parse "other|fifo|rr|batch|idle" into a SCHED_* policy; -1 if unknown
+ */
+int latency_policy_parse(const char *name, int *policy);
+
+/**
+ * Name of a SCHED_* policy as accepted by latency_policy_parse()
+ */
+const char *latency_policy_name(int policy);
+
+/**
+ * Starts the probe thread. Returns -1 (reason on stderr) if the thread
+ * cannot be created or its policy/priority/CPU cannot be applied.
+ */
+int latency_probe_start(const latency_params_t *params);
+
+/**
+ * Stops the probe thread and prints the LATENCY_RESULT line (and writes
+ * the histogram file). No-op if the probe was not started.
+ */
+void latency_probe_stop(const char *tag);
+
+#endif /* LATENCY_H */
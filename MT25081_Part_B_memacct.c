@@ -0,0 +1,121 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_memacct.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/**
+ *
+ * Per-process memory accounting (see memacct.h).
+ *
+ * A worker reads /proc/self/smaps_rollup only if it is the first worker of
+ * its process: all progA children are first, of progB's threads only
+ * worker 1 is, of progH's the first thread of each child (every backend
+ * gives the workers of one process consecutive ids). The walk of a large
+ * process's page tables is then done once per process, not once per thread.
+ * ============================================================================
+ */
+
+memacct_t *memacct_create(int num_workers) {
+    memacct_t *acct = mmap(NULL, sizeof(memacct_t), PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (acct == MAP_FAILED) {
+        perror("mmap");
+        return NULL;
+    }
+    acct->barrier = barrier_create(BARRIER_FUTEX, num_workers);
+    if (acct->barrier == NULL) {
+        munmap(acct, sizeof(memacct_t));
+        return NULL;
+    }
+    acct->parties = num_workers;
+    acct->driver_pid = (int)getpid();
+    return acct;
+}
+
+void memacct_free(memacct_t *acct) {
+    if (acct != NULL) {
+        barrier_free(acct->barrier);
+        munmap(acct, sizeof(memacct_t));
+    }
+}
+
+void memacct_sample(memacct_t *acct, int worker_id) {
+    barrier_local_t local;
+    barrier_local_init(&local, worker_id - 1);
+    memacct_slot_t *slot = &acct->slots[worker_id - 1];
+    slot->pid = (int)getpid();
+
+    // Peak: every worker is done with its units and nothing is freed yet
+    barrier_wait(acct->barrier, &local);
+    if (worker_id == 1 || acct->slots[worker_id - 2].pid != slot->pid) {
+        smaps_rollup_read(0, &slot->mem);
+        slot->sampled = 1;
+    }
+    if (worker_id == 1 && slot->pid != acct->driver_pid) {
+        smaps_rollup_read(acct->driver_pid, &acct->driver_mem);
+    }
+    // No process exits (and shifts the PSS split) before all are read
+    barrier_wait(acct->barrier, &local);
+}
+
+/**
+ * memacct_print_process() - One "[tag] SMAPS ..." line; adds it to total
+ */
+static void memacct_print_process(const char *tag, int pid, int workers,
+                                  const smaps_rollup_t *mem, smaps_rollup_t *total) {
+    printf("[%s] SMAPS pid=%d workers=%d rss_kb=%lld pss_kb=%lld uss_kb=%lld "
+           "shared_clean_kb=%lld shared_dirty_kb=%lld private_clean_kb=%lld "
+           "private_dirty_kb=%lld anon_huge_kb=%lld\n",
+           tag, pid, workers, mem->rss_kb, mem->pss_kb, smaps_uss_kb(mem),
+           mem->shared_clean_kb, mem->shared_dirty_kb, mem->private_clean_kb,
+           mem->private_dirty_kb, mem->anon_huge_kb);
+    total->rss_kb += mem->rss_kb;
+    total->pss_kb += mem->pss_kb;
+    total->shared_clean_kb += mem->shared_clean_kb;
+    total->shared_dirty_kb += mem->shared_dirty_kb;
+    total->private_clean_kb += mem->private_clean_kb;
+    total->private_dirty_kb += mem->private_dirty_kb;
+    total->anon_huge_kb += mem->anon_huge_kb;
+}
+
+void memacct_report(const char *tag, const memacct_t *acct) {
+    smaps_rollup_t total;
+    memset(&total, 0, sizeof(total));
+    int processes = 0, valid = 1, driver_sampled = 0;
+
+    for (int i = 0; i < acct->parties; i++) {
+        const memacct_slot_t *slot = &acct->slots[i];
+        if (!slot->sampled) {
+            continue;
+        }
+        int workers = 0;
+        for (int j = 0; j < acct->parties; j++) {
+            workers += acct->slots[j].pid == slot->pid;
+        }
+        memacct_print_process(tag, slot->pid, workers, &slot->mem, &total);
+        valid &= slot->mem.valid;
+        driver_sampled |= slot->pid == acct->driver_pid;
+        processes++;
+    }
+    if (!driver_sampled) {
+        memacct_print_process(tag, acct->driver_pid, 0, &acct->driver_mem, &total);
+        valid &= acct->driver_mem.valid;
+        processes++;
+    }
+    if (!valid) {
+        fprintf(stderr, "Warning: smaps_rollup unreadable for some processes; "
+                        "MEM_RESULT totals are incomplete\n");
+    }
+
+    int n = acct->parties;
+    long long uss = smaps_uss_kb(&total);
+    printf("[%s] MEM_RESULT workers=%d processes=%d rss_total_kb=%lld pss_total_kb=%lld "
+           "uss_total_kb=%lld shared_total_kb=%lld anon_huge_total_kb=%lld "
+           "rss_per_worker_kb=%lld pss_per_worker_kb=%lld uss_per_worker_kb=%lld\n",
+           tag, n, processes, total.rss_kb, total.pss_kb, uss,
+           total.shared_clean_kb + total.shared_dirty_kb, total.anon_huge_kb,
+           total.rss_kb / n, total.pss_kb / n, uss / n);
+    fflush(stdout);
+}
@@ -0,0 +1,70 @@
+#ifndef MEMACCT_H
+#define MEMACCT_H
+
+#include "MT25081_Part_B_barrier.h"
+#include "MT25081_Part_B_metrics.h"
+
+/**
+ * Per-process memory accounting from smaps_rollup (--smaps).
+ *
+ * Summing RSS over progA's children counts every shared page (libc, the
+ * copy-on-write image inherited from the driver) once per child. PSS
+ * divides each page among the processes that map it, so PSS summed over
+ * all processes is their real combined footprint, and Private_* (USS) is
+ * what one process alone costs.
+ *
+ * Every worker calls memacct_sample() after its last unit, before its
+ * report and teardown free anything. A barrier makes all workers wait
+ * until each has reached its peak, then the rollups are read while every
+ * process is still alive. Each process is read once: every progA child
+ * (and the first thread of each progH child) reads its own, worker 1 also
+ * the driver's, and in progB worker 1 reads the one process. After the
+ * backend returns the driver prints one "[tag] SMAPS ..." line per process
+ * and a "[tag] MEM_RESULT ..." line with the totals and the per-worker
+ * share (totals / N, driver included).
+ */
+
+/**
+ * Rollup of the process one worker runs in, one cache line each
+ */
+typedef struct {
+    int pid;                 // getpid() of the worker
+    int sampled;             // 1 if this worker read mem (first worker of its process)
+    smaps_rollup_t mem;
+} __attribute__((aligned(64))) memacct_slot_t;
+
+/**
+ * State shared by the driver and all workers (MAP_SHARED, created before fork)
+ */
+typedef struct memacct {
+    barrier_t *barrier;                        // Peak and read barriers
+    int parties;                               // Number of workers
+    int driver_pid;                            // getpid() of the driver
+    smaps_rollup_t driver_mem;                 // Driver's rollup, if not a worker process
+    memacct_slot_t slots[BARRIER_MAX_PARTIES]; // Indexed by worker_id - 1
+} memacct_t;
+
+/**
+ * Maps the accounting state for num_workers workers.
+ * Returns NULL (reason on stderr) on failure.
+ */
+memacct_t *memacct_create(int num_workers);
+
+/**
+ * Worker side: waits for all workers to finish their units, reads the
+ * rollup(s) this worker is responsible for, and waits until all are read.
+ * Every worker must call it exactly once, even if its worker failed.
+ */
+void memacct_sample(memacct_t *acct, int worker_id);
+
+/**
+ * Prints the SMAPS and MEM_RESULT lines after all workers have sampled
+ */
+void memacct_report(const char *tag, const memacct_t *acct);
+
+/**
+ * Unmaps the state from memacct_create()
+ */
+void memacct_free(memacct_t *acct);
+
+#endif /* MEMACCT_H */
@@ -0,0 +1,259 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_metrics.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ *
+ * Small readers for kernel-exported metrics used by the benchmark drivers:
+ *
+ * 1. /proc/meminfo         - memory totals and kernel memory (kB)
+ * 2. /proc/vmstat          - paging counters (swap-in/out, major faults)
+ * 3. /proc/pressure/<res>  - Pressure Stall Information (PSI)
+ * 4. cgroup v2 files       - memory.max and per-cgroup <res>.pressure
+ * 5. /proc/<pid>/smaps_rollup - RSS/PSS/USS of one process
+ *
+ * All readers return -1 (or valid = 0) when a file is missing, so the
+ * drivers keep working on kernels without PSI or cgroup v2.
+ * ============================================================================
+ */
+
+/**
+ * read_keyed_value() - Finds "<key><sep>value" in a file and parses the value
+ */
+static long long read_keyed_value(const char *path, const char *key) {
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return -1;
+    }
+
+    char line[256];
+    size_t key_len = strlen(key);
+    long long value = -1;
+
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        // Match the whole key: "MemTotal:" in meminfo, "pswpin " in vmstat
+        if (strncmp(line, key, key_len) == 0 &&
+            (line[key_len] == ':' || line[key_len] == ' ')) {
+            value = strtoll(line + key_len + 1, NULL, 10);
+            break;
+        }
+    }
+
+    fclose(fp);
+    return value;
+}
+
+long long meminfo_read_kb(const char *key) {
+    return read_keyed_value("/proc/meminfo", key);
+}
+
+long long vmstat_read(const char *key) {
+    return read_keyed_value("/proc/vmstat", key);
+}
+
+/**
+ * psi_read_path() - Parses a PSI file of the form:
+ *   some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+ *   full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+ */
+static int psi_read_path(const char *path, psi_sample_t *sample) {
+    memset(sample, 0, sizeof(*sample));
+
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return -1;
+    }
+
+    char kind[8];
+    double avg10, avg60, avg300;
+    unsigned long long total;
+
+    while (fscanf(fp, "%7s avg10=%lf avg60=%lf avg300=%lf total=%llu",
+                  kind, &avg10, &avg60, &avg300, &total) == 5) {
+        if (strcmp(kind, "some") == 0) {
+            sample->some_avg10 = avg10;
+            sample->some_total_us = total;
+            sample->valid = 1;
+        } else if (strcmp(kind, "full") == 0) {
+            sample->full_avg10 = avg10;
+            sample->full_total_us = total;
+        }
+    }
+
+    fclose(fp);
+    return sample->valid ? 0 : -1;
+}
+
+int smaps_rollup_read(pid_t pid, smaps_rollup_t *rollup) {
+    memset(rollup, 0, sizeof(*rollup));
+
+    char path[64];
+    if (pid == 0) {
+        snprintf(path, sizeof(path), "/proc/self/smaps_rollup");
+    } else {
+        snprintf(path, sizeof(path), "/proc/%d/smaps_rollup", (int)pid);
+    }
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return -1;
+    }
+
+    // "Pss:   1234 kB" lines after one header line naming the range
+    static const struct {
+        const char *key;
+        size_t offset;
+    } fields[] = {
+        {"Rss:", offsetof(smaps_rollup_t, rss_kb)},
+        {"Pss:", offsetof(smaps_rollup_t, pss_kb)},
+        {"Shared_Clean:", offsetof(smaps_rollup_t, shared_clean_kb)},
+        {"Shared_Dirty:", offsetof(smaps_rollup_t, shared_dirty_kb)},
+        {"Private_Clean:", offsetof(smaps_rollup_t, private_clean_kb)},
+        {"Private_Dirty:", offsetof(smaps_rollup_t, private_dirty_kb)},
+        {"AnonHugePages:", offsetof(smaps_rollup_t, anon_huge_kb)},
+    };
+    char line[256];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+            size_t len = strlen(fields[i].key);
+            if (strncmp(line, fields[i].key, len) == 0) {
+                *(long long *)((char *)rollup + fields[i].offset) = strtoll(line + len, NULL, 10);
+                rollup->valid = 1;
+                break;
+            }
+        }
+    }
+
+    fclose(fp);
+    return rollup->valid ? 0 : -1;
+}
+
+long long smaps_uss_kb(const smaps_rollup_t *rollup) {
+    return rollup->private_clean_kb + rollup->private_dirty_kb;
+}
+
+int psi_read(const char *resource, psi_sample_t *sample) {
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/pressure/%s", resource);
+    return psi_read_path(path, sample);
+}
+
+/**
+ * cgroup_path() - Builds the path of a file in this process's cgroup v2 dir
+ *
+ * /proc/self/cgroup has a "0::/<path>" line for the unified hierarchy.
+ * It is mounted at /sys/fs/cgroup (pure v2) or /sys/fs/cgroup/unified (hybrid).
+ */
+static int cgroup_path(const char *name, char *out, size_t len) {
+    FILE *fp = fopen("/proc/self/cgroup", "r");
+    if (fp == NULL) {
+        return -1;
+    }
+
+    char line[512];
+    char rel[512] = "";
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (strncmp(line, "0::", 3) == 0) {
+            strncpy(rel, line + 3, sizeof(rel) - 1);
+            rel[strcspn(rel, "\n")] = '\0';
+            break;
+        }
+    }
+    fclose(fp);
+
+    if (rel[0] == '\0') {
+        return -1;
+    }
+
+    // The root cgroup is "/", so avoid a double slash when joining
+    const char *sep = (strcmp(rel, "/") == 0) ? "" : rel;
+    const char *mounts[] = {"/sys/fs/cgroup", "/sys/fs/cgroup/unified"};
+    for (size_t i = 0; i < sizeof(mounts) / sizeof(mounts[0]); i++) {
+        snprintf(out, len, "%s%s/%s", mounts[i], sep, name);
+        FILE *probe = fopen(out, "r");
+        if (probe != NULL) {
+            fclose(probe);
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int cgroup_read_file(const char *name, char *buf, size_t len) {
+    char path[1024];
+    if (cgroup_path(name, path, sizeof(path)) != 0) {
+        return -1;
+    }
+
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return -1;
+    }
+
+    if (fgets(buf, (int)len, fp) == NULL) {
+        fclose(fp);
+        return -1;
+    }
+    buf[strcspn(buf, "\n")] = '\0';
+    fclose(fp);
+    return 0;
+}
+
+int psi_read_cgroup(const char *resource, psi_sample_t *sample) {
+    char name[64];
+    char path[1024];
+    snprintf(name, sizeof(name), "%s.pressure", resource);
+
+    if (cgroup_path(name, path, sizeof(path)) == 0 &&
+        psi_read_path(path, sample) == 0) {
+        return 0;
+    }
+    return psi_read(resource, sample);
+}
+
+long long cgroup_memory_max_kb(void) {
+    char buf[64];
+    if (cgroup_read_file("memory.max", buf, sizeof(buf)) != 0 ||
+        strcmp(buf, "max") == 0) {
+        return -1;
+    }
+    return strtoll(buf, NULL, 10) / 1024;
+}
+
+void pressure_snapshot(pressure_snapshot_t *snap) {
+    clock_gettime(CLOCK_MONOTONIC, &snap->when);
+    snap->pswpin = vmstat_read("pswpin");
+    snap->pswpout = vmstat_read("pswpout");
+    snap->pgmajfault = vmstat_read("pgmajfault");
+    psi_read_cgroup("memory", &snap->psi_memory);
+}
+
+void pressure_report(const char *tag, const pressure_snapshot_t *before,
+                     const pressure_snapshot_t *after, long majflt,
+                     double bytes_swept) {
+    double elapsed = (after->when.tv_sec - before->when.tv_sec) +
+                     (after->when.tv_nsec - before->when.tv_nsec) / 1e9;
+    double throughput_mbps = elapsed > 0 ? bytes_swept / elapsed / (1024.0 * 1024.0) : 0.0;
+
+    long long swap_in = after->pswpin - before->pswpin;
+    long long swap_out = after->pswpout - before->pswpout;
+    long long sys_majflt = after->pgmajfault - before->pgmajfault;
+
+    // PSI totals are cumulative, so the delta is the stall time of this run
+    unsigned long long psi_some = 0, psi_full = 0;
+    if (before->psi_memory.valid && after->psi_memory.valid) {
+        psi_some = after->psi_memory.some_total_us - before->psi_memory.some_total_us;
+        psi_full = after->psi_memory.full_total_us - before->psi_memory.full_total_us;
+    }
+
+    printf("[%s] Memory pressure report:\n", tag);
+    printf("[%s]   Major faults (workers): %ld (system-wide: %lld)\n", tag, majflt, sys_majflt);
+    printf("[%s]   Swap-in / swap-out pages: %lld / %lld\n", tag, swap_in, swap_out);
+    printf("[%s]   Memory PSI stall: some=%llu us, full=%llu us\n", tag, psi_some, psi_full);
+    printf("[%s]   Sweep throughput: %.2f MB/s over %.2f s\n", tag, throughput_mbps, elapsed);
+    printf("[%s] RESULT majflt=%ld pswpin=%lld pswpout=%lld psi_mem_some_us=%llu "
+           "psi_mem_full_us=%llu throughput_mbps=%.2f elapsed_s=%.3f\n",
+           tag, majflt, swap_in, swap_out, psi_some, psi_full, throughput_mbps, elapsed);
+    fflush(stdout);
+}
@@ -0,0 +1,115 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <time.h>
+#include <sys/types.h>
+
+/**
+ * Pressure Stall Information for one resource (cpu, memory or io).
+ * Read from /proc/pressure/<resource> or a cgroup's <resource>.pressure file.
+ * The "full" line does not exist for cpu on older kernels; full_* stays 0.
+ */
+typedef struct {
+    int valid;                        // 1 if the file was readable and parsed
+    double some_avg10;                // % of time at least one task stalled (10s avg)
+    double full_avg10;                // % of time all tasks stalled (10s avg)
+    unsigned long long some_total_us; // Cumulative "some" stall time in microseconds
+    unsigned long long full_total_us; // Cumulative "full" stall time in microseconds
+} psi_sample_t;
+
+/**
+ * System-wide memory-pressure counters captured before and after a run.
+ * The difference between two snapshots is what the run cost in reclaim.
+ */
+typedef struct {
+    struct timespec when;             // CLOCK_MONOTONIC timestamp
+    long long pswpin;                 // Pages swapped in (/proc/vmstat)
+    long long pswpout;                // Pages swapped out (/proc/vmstat)
+    long long pgmajfault;             // Major faults system-wide (/proc/vmstat)
+    psi_sample_t psi_memory;          // Memory PSI of this cgroup (or system)
+} pressure_snapshot_t;
+
+/**
+ * Memory of one process from /proc/<pid>/smaps_rollup (all values in kB).
+ * Rss counts every resident page the process maps; Pss splits each page
+ * evenly among the processes that map it, so Pss summed over processes is
+ * their true combined footprint. Private_* is memory only this process
+ * maps (its USS); Shared_* is resident and mapped by others too.
+ */
+typedef struct {
+    int valid;                        // 1 if the file was readable and parsed
+    long long rss_kb;
+    long long pss_kb;
+    long long shared_clean_kb;
+    long long shared_dirty_kb;
+    long long private_clean_kb;
+    long long private_dirty_kb;
+    long long anon_huge_kb;           // AnonHugePages
+} smaps_rollup_t;
+
+/**
+ * Reads /proc/<pid>/smaps_rollup (pid 0: the calling process).
+ * Returns 0 on success, -1 if the file is missing (kernels before 4.14)
+ * or unreadable (rollup->valid is set to 0).
+ */
+int smaps_rollup_read(pid_t pid, smaps_rollup_t *rollup);
+
+/**
+ * Unique set size of a rollup: Private_Clean + Private_Dirty
+ */
+long long smaps_uss_kb(const smaps_rollup_t *rollup);
+
+/**
+ * Reads a value (in kB) from /proc/meminfo, e.g. "MemTotal" or "PageTables".
+ * Returns -1 if the key is missing or the file cannot be read.
+ */
+long long meminfo_read_kb(const char *key);
+
+/**
+ * Reads a counter from /proc/vmstat, e.g. "pswpin" or "pgmajfault".
+ * Returns -1 if the key is missing or the file cannot be read.
+ */
+long long vmstat_read(const char *key);
+
+/**
+ * Reads system-wide PSI for "cpu", "memory" or "io" from /proc/pressure.
+ * Returns 0 on success, -1 if PSI is unavailable (sample->valid is set to 0).
+ */
+int psi_read(const char *resource, psi_sample_t *sample);
+
+/**
+ * Reads PSI from the calling process's cgroup v2 <resource>.pressure file,
+ * falling back to the system-wide /proc/pressure file.
+ */
+int psi_read_cgroup(const char *resource, psi_sample_t *sample);
+
+/**
+ * Reads a file from the calling process's cgroup v2 directory
+ * (e.g. "memory.max") into buf, stripping the trailing newline.
+ * Returns 0 on success, -1 if the file does not exist or cannot be read.
+ */
+int cgroup_read_file(const char *name, char *buf, size_t len);
+
+/**
+ * Returns the calling process's cgroup memory.max in kB, or -1 if the
+ * cgroup is unlimited ("max") or not readable.
+ */
+long long cgroup_memory_max_kb(void);
+
+/**
+ * Captures the current memory-pressure counters into snap.
+ */
+void pressure_snapshot(pressure_snapshot_t *snap);
+
+/**
+ * Prints the memory-pressure report for a run between two snapshots.
+ * majflt is the drivers' own major fault count (from getrusage) and
+ * bytes_swept the total bytes the workers swept, used for throughput.
+ * Ends with a "[tag] RESULT key=value ..." line parsed by the scripts.
+ */
+void pressure_report(const char *tag, const pressure_snapshot_t *before,
+                     const pressure_snapshot_t *after, long majflt,
+                     double bytes_swept);
+
+#endif /* METRICS_H */
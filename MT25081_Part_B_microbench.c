@@ -0,0 +1,322 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_timing.h"
+
+/**
+ * PURPOSE:
+ *   Microbenchmark harness for the hot kernels in MT25081_Part_B_workers.c.
+ *   Times each kernel in isolation, without the process/thread drivers, so
+ *   a kernel-level change (a new clone level, a different stride, a compiler
+ *   flag) can be evaluated in seconds.
+ *
+ * USAGE:
+ *   ./microbench [options] [kernel...]
+ *
+ *   Options:
+ *   - --min-time=S: Minimum duration of one sample in seconds (default 0.05);
+ *                   repetitions per sample are doubled until a batch lasts
+ *                   at least this long
+ *   - --samples=N:  Number of timed samples per kernel (default 10)
+ *   - --mem-mb=M:   Array size for the mem kernels in MB (default 64)
+ *   - --variants:   Also run every templated kernel variant (kernels.cpp)
+ *   - kernel:       Run only the named kernels or variants (default: all
+ *                   C kernels)
+ *
+ * EXAMPLES:
+ *   ./microbench
+ *   ./microbench --samples=20 leibniz leibniz_volatile
+ *   ./microbench --mem-mb=512 mem_write mem_read
+ *   ./microbench leibniz cpu_f64_u1 cpu_f64_u4 cpu_f32_u8
+ *
+ * OUTPUT:
+ *   One line per kernel:
+ *   [microbench] KERNEL name=<k> reps=<r> samples=<n> ns_per_iter=<mean>
+ *                stddev_ns=<s> cv_pct=<s/mean*100> min_ns=<fastest sample>
+ *   An iteration is one kernel call (see the kernel table below). A mem
+ *   variant prints two lines, <variant>:write and <variant>:read.
+ *
+ * NOTES:
+ *   - Results are consumed with DO_NOT_OPTIMIZE()/CLOBBER_MEMORY() (see
+ *     workers.h) instead of volatile locals, so what is timed is the kernel
+ *     itself and not a store/reload per update.
+ *   - leibniz_volatile is the old volatile-accumulator loop, kept as a
+ *     reference for that distortion.
+ * ============================================================================
+ */
+
+#define DEFAULT_MIN_TIME_S 0.05
+#define DEFAULT_SAMPLES 10
+#define DEFAULT_MEM_MB 64
+#define LEIBNIZ_TERMS 1000       // Terms per leibniz iteration
+#define CHECKSUM_BYTES 4096      // One I/O worker write
+
+static int *mem_array;
+static size_t mem_array_size;    // In ints
+static unsigned char checksum_buffer[CHECKSUM_BYTES];
+
+/**
+ * Kernel runners: each executes reps iterations of one kernel
+ */
+static void run_leibniz(long reps) {
+    double acc = 0.0;
+    for (long r = 0; r < reps; r++) {
+        acc = leibniz_kernel(acc, LEIBNIZ_TERMS);
+        DO_NOT_OPTIMIZE(acc);
+    }
+}
+
+static void run_leibniz_volatile(long reps) {
+    volatile double pi = 0.0;    // Every update is a store and a reload
+    for (long r = 0; r < reps; r++) {
+        for (int i = 0; i < LEIBNIZ_TERMS; i++) {
+            if (i % 2 == 0) {
+                pi += 1.0 / (2.0 * i + 1.0);
+            } else {
+                pi -= 1.0 / (2.0 * i + 1.0);
+            }
+        }
+    }
+}
+
+static void run_mem_write(long reps) {
+    for (long r = 0; r < reps; r++) {
+        mem_write_sweep(mem_array, mem_array_size, (int)r);
+        CLOBBER_MEMORY();
+    }
+}
+
+static void run_mem_read(long reps) {
+    for (long r = 0; r < reps; r++) {
+        int sum = mem_read_sweep(mem_array, mem_array_size);
+        DO_NOT_OPTIMIZE(sum);
+    }
+}
+
+static void run_checksum(long reps) {
+    for (long r = 0; r < reps; r++) {
+        unsigned long sum = buffer_checksum(checksum_buffer, CHECKSUM_BYTES);
+        DO_NOT_OPTIMIZE(sum);
+    }
+}
+
+/**
+ * Templated variant runners: run the variant selected in current_variant
+ */
+static const tkernel_t *current_variant;
+
+static void run_variant_cpu(long reps) {
+    for (long r = 0; r < reps; r++) {
+        double acc = current_variant->cpu(LEIBNIZ_TERMS);
+        DO_NOT_OPTIMIZE(acc);
+    }
+}
+
+static void run_variant_write(long reps) {
+    for (long r = 0; r < reps; r++) {
+        current_variant->mem_write(mem_array, mem_array_size * sizeof(int), (int)r);
+        CLOBBER_MEMORY();
+    }
+}
+
+static void run_variant_read(long reps) {
+    for (long r = 0; r < reps; r++) {
+        long long sum = current_variant->mem_read(mem_array, mem_array_size * sizeof(int));
+        DO_NOT_OPTIMIZE(sum);
+    }
+}
+
+/**
+ * Kernel table
+ */
+typedef struct {
+    const char *name;
+    void (*run)(long reps);
+    const char *iteration;       // What one iteration is, for the listing
+} kernel_t;
+
+static const kernel_t kernels[] = {
+    {"leibniz",          run_leibniz,          "1000 Leibniz terms"},
+    {"leibniz_volatile", run_leibniz_volatile, "1000 Leibniz terms, volatile accumulator"},
+    {"mem_write",        run_mem_write,        "one write sweep over --mem-mb"},
+    {"mem_read",         run_mem_read,         "one read sweep over --mem-mb"},
+    {"checksum",         run_checksum,         "checksum of a 4KB buffer"},
+};
+#define NUM_KERNELS ((int)(sizeof(kernels) / sizeof(kernels[0])))
+
+/**
+ * time_batch() - Seconds taken by reps iterations of a kernel
+ */
+static double time_batch(const kernel_t *k, long reps) {
+    uint64_t t0 = timing_now();
+    k->run(reps);
+    return timing_ticks_to_s(timing_now() - t0);
+}
+
+/**
+ * bench_kernel() - Auto-scales repetitions, then times samples batches
+ *
+ * WHAT IT DOES:
+ *   1. Doubles reps until one batch lasts at least min_time seconds (this
+ *      also warms caches, page tables and the branch predictors)
+ *   2. Times samples batches of reps iterations each
+ *   3. Prints mean, standard deviation, coefficient of variation and the
+ *      fastest sample, all in nanoseconds per iteration
+ */
+static void bench_kernel(const kernel_t *k, double min_time, int samples) {
+    long reps = 1;
+    while (time_batch(k, reps) < min_time && reps < (1L << 40)) {
+        reps *= 2;
+    }
+
+    double sum = 0.0, sum_sq = 0.0, min_ns = 0.0;
+    for (int s = 0; s < samples; s++) {
+        double ns = time_batch(k, reps) * 1e9 / (double)reps;
+        sum += ns;
+        sum_sq += ns * ns;
+        if (s == 0 || ns < min_ns) {
+            min_ns = ns;
+        }
+    }
+
+    double mean = sum / samples;
+    double var = samples > 1 ? (sum_sq - sum * mean) / (samples - 1) : 0.0;
+    double stddev = var > 0.0 ? sqrt(var) : 0.0;
+    printf("[microbench] KERNEL name=%s reps=%ld samples=%d ns_per_iter=%.3f "
+           "stddev_ns=%.3f cv_pct=%.2f min_ns=%.3f\n",
+           k->name, reps, samples, mean, stddev,
+           mean > 0.0 ? stddev / mean * 100.0 : 0.0, min_ns);
+    fflush(stdout);
+}
+
+/**
+ * bench_variant() - Benchmarks one templated variant (cpu: one line,
+ *                   mem: a write and a read line)
+ */
+static void bench_variant(const tkernel_t *variant, double min_time, int samples) {
+    char name[96];
+    current_variant = variant;
+    if (variant->cpu != NULL) {
+        kernel_t k = {variant->name, run_variant_cpu, "1000 Leibniz terms"};
+        bench_kernel(&k, min_time, samples);
+    } else {
+        snprintf(name, sizeof(name), "%s:write", variant->name);
+        kernel_t w = {name, run_variant_write, "one write sweep"};
+        bench_kernel(&w, min_time, samples);
+        snprintf(name, sizeof(name), "%s:read", variant->name);
+        kernel_t r = {name, run_variant_read, "one read sweep"};
+        bench_kernel(&r, min_time, samples);
+    }
+}
+
+/**
+ * print_usage() - Usage message with the kernel list
+ */
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [--min-time=S] [--samples=N] [--mem-mb=M] [--variants] [kernel...]\n",
+            prog);
+    fprintf(stderr, "Kernels:\n");
+    for (int i = 0; i < NUM_KERNELS; i++) {
+        fprintf(stderr, "  %-17s %s\n", kernels[i].name, kernels[i].iteration);
+    }
+    fprintf(stderr, "Templated variants:\n ");
+    for (int i = 0; i < tkernel_count(); i++) {
+        fprintf(stderr, " %s", tkernel_get(i)->name);
+    }
+    fprintf(stderr, "\n");
+}
+
+/**
+ * main() - Entry point for the microbenchmark harness
+ */
+int main(int argc, char *argv[]) {
+    double min_time = DEFAULT_MIN_TIME_S;
+    int samples = DEFAULT_SAMPLES;
+    long mem_mb = DEFAULT_MEM_MB;
+    int selected[NUM_KERNELS] = {0};
+    int any_selected = 0;
+    int all_variants = 0;
+    char *variant_selected = (char *)calloc(tkernel_count(), 1);
+    if (variant_selected == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--min-time=", 11) == 0) {
+            min_time = atof(argv[i] + 11);
+            if (min_time <= 0.0 || min_time > 10.0) {
+                fprintf(stderr, "Error: --min-time must be in (0, 10]\n");
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[i], "--samples=", 10) == 0) {
+            samples = atoi(argv[i] + 10);
+            if (samples < 1 || samples > 1000) {
+                fprintf(stderr, "Error: --samples must be between 1 and 1000\n");
+                exit(EXIT_FAILURE);
+            }
+        } else if (strncmp(argv[i], "--mem-mb=", 9) == 0) {
+            mem_mb = atol(argv[i] + 9);
+            if (mem_mb < 1 || mem_mb > 65536) {
+                fprintf(stderr, "Error: --mem-mb must be between 1 and 65536\n");
+                exit(EXIT_FAILURE);
+            }
+        } else if (strcmp(argv[i], "--variants") == 0) {
+            all_variants = 1;
+        } else {
+            int found = 0;
+            for (int k = 0; k < NUM_KERNELS; k++) {
+                if (strcmp(argv[i], kernels[k].name) == 0) {
+                    selected[k] = 1;
+                    found = 1;
+                }
+            }
+            for (int v = 0; v < tkernel_count(); v++) {
+                if (strcmp(argv[i], tkernel_get(v)->name) == 0) {
+                    variant_selected[v] = 1;
+                    found = 1;
+                }
+            }
+            if (!found) {
+                fprintf(stderr, "Error: unknown kernel or option '%s'\n", argv[i]);
+                print_usage(argv[0]);
+                exit(EXIT_FAILURE);
+            }
+            any_selected = 1;
+        }
+    }
+
+    // Kernel inputs, touched once so page faults stay out of the timings
+    mem_array_size = (size_t)mem_mb * 1024 * 1024 / sizeof(int);
+    mem_array = (int *)malloc(mem_array_size * sizeof(int));
+    if (mem_array == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(mem_array, 0, mem_array_size * sizeof(int));
+    memset(checksum_buffer, 'A', sizeof(checksum_buffer));
+
+    timing_init();
+    printf("[microbench] Kernel clone selected: %s\n", kernel_isa_level());
+    printf("[microbench] Timer: %s, %.6f ns/tick, %.1f ns/read\n",
+           timing_source(), timing_ns_per_tick, timing_overhead_ns());
+    printf("[microbench] min_time=%.3fs samples=%d mem_mb=%ld\n", min_time, samples, mem_mb);
+
+    for (int k = 0; k < NUM_KERNELS; k++) {
+        if (!any_selected || selected[k]) {
+            bench_kernel(&kernels[k], min_time, samples);
+        }
+    }
+    for (int v = 0; v < tkernel_count(); v++) {
+        if (all_variants || variant_selected[v]) {
+            bench_variant(tkernel_get(v), min_time, samples);
+        }
+    }
+
+    free(mem_array);
+    free(variant_selected);
+    return 0;
+}
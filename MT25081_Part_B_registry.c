@@ -0,0 +1,250 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_registry.h"
+#include "MT25081_Part_B_timing.h"
+#include "MT25081_Part_B_bsp.h"
+#include "MT25081_Part_B_imbalance.h"
+#include "MT25081_Part_B_atomic.h"
+#include "MT25081_Part_B_signal.h"
+#include "MT25081_Part_B_fdchurn.h"
+#include "MT25081_Part_B_cow.h"
+#include "MT25081_Part_B_kmem.h"
+#include <stddef.h>
+#include <dlfcn.h>
+
+/**
+ *
+ * Worker table and the generic worker runner.
+ *
+ * Each entry pairs a worker_ops_t with the work_params_t field that holds
+ * its unit count, so --mem-passes, --target-seconds calibration and --units
+ * all size the right worker without a per-type switch.
+ * ============================================================================
+ */
+
+typedef struct {
+    const worker_ops_t *ops;
+    size_t units_offset;     // offsetof(work_params_t, <count field>)
+    unsigned flags;          // WORKER_OWN_UNITS, ...
+    worker_setup_fn setup;   // Driver-side shared state (optional)
+    worker_cleanup_fn cleanup;
+} worker_entry_t;
+
+static worker_entry_t registry[MAX_WORKERS] = {
+    {&cpu_worker_ops, offsetof(work_params_t, cpu_iterations), 0, NULL, NULL},
+    {&mem_worker_ops, offsetof(work_params_t, mem_passes), 0, NULL, NULL},
+    {&io_worker_ops,  offsetof(work_params_t, io_passes), 0, NULL, NULL},
+    {&bsp_worker_ops, offsetof(work_params_t, bsp_supersteps), WORKER_OWN_UNITS,
+     bsp_setup, bsp_cleanup},
+    {&imbalance_worker_ops, offsetof(work_params_t, imb_rounds), WORKER_OWN_UNITS,
+     imbalance_setup, imbalance_cleanup},
+    {&atomic_worker_ops, offsetof(work_params_t, atomic_batches), 0,
+     atomic_setup, atomic_cleanup},
+    {&signal_worker_ops, offsetof(work_params_t, sig_rounds), WORKER_OWN_UNITS,
+     signal_setup, signal_cleanup},
+    {&fdchurn_worker_ops, offsetof(work_params_t, fd_batches), 0,
+     fdchurn_setup, fdchurn_cleanup},
+    {&cow_worker_ops, offsetof(work_params_t, cow_batches), 0, cow_setup, cow_cleanup},
+    {&idle_worker_ops, offsetof(work_params_t, idle_sleeps), 0, NULL, NULL},
+};
+static int registry_count = 10;
+
+/**
+ * find_entry() - Registry entry for a worker name, or NULL
+ */
+static const worker_entry_t *find_entry(const char *name) {
+    for (int i = 0; i < registry_count; i++) {
+        if (strcmp(registry[i].ops->name, name) == 0) {
+            return &registry[i];
+        }
+    }
+    return NULL;
+}
+
+const worker_ops_t *worker_find(const char *name) {
+    const worker_entry_t *entry = find_entry(name);
+    return entry ? entry->ops : NULL;
+}
+
+int worker_load_plugin(const char *path) {
+#ifdef BENCH_STATIC
+    // Static drivers (progA.static, ...) cannot dlopen() a shared object
+    fprintf(stderr, "Error: cannot load worker plugin %s: this driver is statically linked\n",
+            path);
+    return -1;
+#else
+    // RTLD_NOW: report missing symbols here, not in the middle of a run
+    void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (handle == NULL) {
+        fprintf(stderr, "Error: cannot load worker plugin: %s\n", dlerror());
+        return -1;
+    }
+    const worker_ops_t *ops = (const worker_ops_t *)dlsym(handle, WORKER_PLUGIN_SYMBOL);
+    if (ops == NULL) {
+        fprintf(stderr, "Error: %s does not export %s\n", path, WORKER_PLUGIN_SYMBOL);
+        dlclose(handle);
+        return -1;
+    }
+    if (ops->api_version != WORKER_API_VERSION || ops->name == NULL || ops->run_unit == NULL) {
+        fprintf(stderr, "Error: %s: incompatible worker API (version %d, expected %d)\n",
+                path, ops->api_version, WORKER_API_VERSION);
+        dlclose(handle);
+        return -1;
+    }
+    if (find_entry(ops->name) != NULL) {
+        fprintf(stderr, "Error: %s: worker '%s' is already registered\n", path, ops->name);
+        dlclose(handle);
+        return -1;
+    }
+    if (registry_count == MAX_WORKERS) {
+        fprintf(stderr, "Error: too many workers registered (max %d)\n", MAX_WORKERS);
+        dlclose(handle);
+        return -1;
+    }
+    // The handle stays open for the life of the process (children inherit it)
+    registry[registry_count].ops = ops;
+    registry[registry_count].units_offset = offsetof(work_params_t, plugin_units);
+    registry_count++;
+    return 0;
+#endif
+}
+
+void worker_print_names(FILE *fp) {
+    for (int i = 0; i < registry_count; i++) {
+        fprintf(fp, "%s%s", i ? ", " : "", registry[i].ops->name);
+    }
+    fprintf(fp, "\n");
+}
+
+/**
+ * units_offset() - Offset of a worker's unit count field in work_params_t
+ */
+static size_t units_offset(const worker_ops_t *ops) {
+    const worker_entry_t *entry = find_entry(ops->name);
+    return entry ? entry->units_offset : offsetof(work_params_t, plugin_units);
+}
+
+int *worker_units(const worker_ops_t *ops, work_params_t *work) {
+    return (int *)((char *)work + units_offset(ops));
+}
+
+int worker_owns_units(const worker_ops_t *ops) {
+    const worker_entry_t *entry = find_entry(ops->name);
+    return entry && (entry->flags & WORKER_OWN_UNITS);
+}
+
+int worker_has_setup(const worker_ops_t *ops) {
+    const worker_entry_t *entry = find_entry(ops->name);
+    return entry && entry->setup;
+}
+
+int worker_setup(const worker_ops_t *ops, work_params_t *work, int num_workers,
+                 const char *tag) {
+    const worker_entry_t *entry = find_entry(ops->name);
+    return entry && entry->setup ? entry->setup(work, num_workers, tag) : 0;
+}
+
+void worker_cleanup(const worker_ops_t *ops, work_params_t *work, const char *tag) {
+    const worker_entry_t *entry = find_entry(ops->name);
+    if (entry && entry->cleanup) {
+        entry->cleanup(work, tag);
+    }
+}
+
+void worker_ctx_init(worker_ctx_t *ctx, const worker_ops_t *ops, const char *tag,
+                     int worker_id, const work_params_t *work) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->tag = tag;
+    ctx->worker_id = worker_id;
+    ctx->units = *(const int *)((const char *)work + units_offset(ops));
+    ctx->arg = work->worker_arg;
+    ctx->work = work;
+    ctx->ns_per_tick = timing_ns_per_tick;
+}
+
+int worker_unit(const worker_ops_t *ops, worker_ctx_t *ctx) {
+    // Each unit is timed here, so every worker gets the same per-unit stats
+    uint64_t t0 = timing_now();
+    if (ops->run_unit(ctx) != 0) {
+        return -1;
+    }
+    unit_stats_add(&ctx->stats, timing_now() - t0);
+    return 0;
+}
+
+void worker_finish(const worker_ops_t *ops, worker_ctx_t *ctx, int rc) {
+    if (rc == 0) {
+        if (ops->report != NULL) {
+            ops->report(ctx);
+        } else {
+            unit_stats_print(ctx->tag, "UNIT_STATS", ctx->worker_id, &ctx->stats);
+        }
+    }
+    if (ops->teardown != NULL) {
+        ops->teardown(ctx);
+    }
+}
+
+int worker_run(const worker_ops_t *ops, worker_ctx_t *ctx) {
+    if (ops->init != NULL && ops->init(ctx) != 0) {
+        return -1;
+    }
+
+    int rc = 0;
+    for (int u = 0; u < ctx->units; u++) {
+        if (worker_unit(ops, ctx) != 0) {
+            rc = -1;
+            break;
+        }
+    }
+    worker_finish(ops, ctx, rc);
+    return rc;
+}
+
+/**
+ * calibrate_work() - Sizes a worker's unit count to a target duration
+ *
+ * HOW IT WORKS:
+ *   - init, then one untimed warm-up unit (mem: first-touch page faults are
+ *     not part of a steady-state pass; io: the file is created)
+ *   - units are timed until at least 50 ms have elapsed (one io pass
+ *     usually exceeds that on its own)
+ *   count = target_seconds / seconds_per_unit, at least 1.
+ *
+ *   The probe runs on the calling (parent/main) thread before any worker
+ *   starts, so the target is the duration of one worker running alone.
+ *   Workers with a setup hook are never probed: their units need the
+ *   other N-1 workers (barriers, the signal supervisor), so bench refuses
+ *   --target-seconds for them.
+ */
+#define CALIBRATION_MIN_PROBE_S 0.05
+
+int calibrate_work(const worker_ops_t *ops, double target_seconds,
+                   work_params_t *work, double *unit_seconds) {
+    worker_ctx_t ctx;
+    worker_ctx_init(&ctx, ops, "calibrate", 0, work);
+    if (ops->init != NULL && ops->init(&ctx) != 0) {
+        return -1;
+    }
+
+    int units = 0;
+    double elapsed = 0.0;
+    int rc = ops->run_unit(&ctx);   // Warm-up, not timed
+    uint64_t t0 = timing_now();
+    while (rc == 0 && elapsed < CALIBRATION_MIN_PROBE_S) {
+        rc = ops->run_unit(&ctx);
+        units++;
+        elapsed = timing_ticks_to_s(timing_now() - t0);
+    }
+    if (ops->teardown != NULL) {
+        ops->teardown(&ctx);
+    }
+    if (rc != 0) {
+        return -1;
+    }
+
+    *unit_seconds = elapsed / units;
+    double count = target_seconds / *unit_seconds;
+    int calibrated = count < 1.0 ? 1 : (count > 1e9 ? 1000000000 : (int)(count + 0.5));
+    *worker_units(ops, work) = calibrated;
+    return calibrated;
+}
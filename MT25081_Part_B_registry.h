@@ -0,0 +1,113 @@
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+#include <stdio.h>
+#include "MT25081_Part_B_workers.h"
+
+/**
+ * Worker registry shared by progA and progB.
+ *
+ * Workers are looked up by name in one table that holds the built-ins
+ * (cpu, mem, io, bsp, imbalance, atomic, signal, fdchurn, cow, idle) and any
+ * plugins loaded with --worker-lib, so the drivers never compare worker type
+ * strings or ops pointers themselves.
+ */
+
+#define MAX_WORKERS 16   // Built-ins plus loaded plugins
+
+/**
+ * Driver-side hooks of a built-in worker, run by bench_main() in the driver
+ * process around the backend (not part of the plugin ABI; NULL = none):
+ *   setup(work, n, tag) - maps the worker's shared state for n workers and
+ *                         prints its "[tag] <WORKER> ..." startup line;
+ *                         -1 (reason on stderr) aborts the run
+ *   cleanup(work, tag)  - once all workers finished: driver-side results,
+ *                         then unmaps what setup() mapped
+ */
+/**
+ * Worker flags:
+ *   WORKER_OWN_UNITS - workers synchronize with each other (barriers,
+ *                      signals), so every worker must run exactly its own
+ *                      units; backends may not rebalance them (OpenMP)
+ */
+#define WORKER_OWN_UNITS 0x1
+
+typedef int (*worker_setup_fn)(work_params_t *work, int num_workers, const char *tag);
+typedef void (*worker_cleanup_fn)(work_params_t *work, const char *tag);
+
+/**
+ * Finds a registered worker by name; NULL if unknown
+ */
+const worker_ops_t *worker_find(const char *name);
+
+/**
+ * dlopen()s a plugin and registers the worker_ops_t it exports as
+ * WORKER_PLUGIN_SYMBOL. Prints the reason to stderr and returns -1 on failure
+ * (always, in a -DBENCH_STATIC build: static drivers cannot dlopen()).
+ */
+int worker_load_plugin(const char *path);
+
+/**
+ * Prints the registered worker names as "cpu, mem, io, ..." to fp
+ */
+void worker_print_names(FILE *fp);
+
+/**
+ * The work_params_t field holding a worker's unit count: cpu_iterations,
+ * mem_passes, io_passes, bsp_supersteps, imb_rounds, or plugin_units for plugins
+ */
+int *worker_units(const worker_ops_t *ops, work_params_t *work);
+
+/**
+ * Nonzero if the worker has WORKER_OWN_UNITS set
+ */
+int worker_owns_units(const worker_ops_t *ops);
+
+/**
+ * Nonzero if the worker has a setup hook (its units need shared state
+ * from the driver, so it cannot be calibrated alone)
+ */
+int worker_has_setup(const worker_ops_t *ops);
+
+/**
+ * Runs a worker's setup/cleanup hook; no-ops (setup returns 0) for workers
+ * without one
+ */
+int worker_setup(const worker_ops_t *ops, work_params_t *work, int num_workers,
+                 const char *tag);
+void worker_cleanup(const worker_ops_t *ops, work_params_t *work, const char *tag);
+
+/**
+ * Fills a worker context for worker number worker_id (1..N)
+ */
+void worker_ctx_init(worker_ctx_t *ctx, const worker_ops_t *ops, const char *tag,
+                     int worker_id, const work_params_t *work);
+
+/**
+ * Runs one worker: init, ctx->units timed run_unit() calls, report,
+ * teardown. Returns 0 on success, -1 if init or a unit failed.
+ */
+int worker_run(const worker_ops_t *ops, worker_ctx_t *ctx);
+
+/**
+ * The two halves of worker_run() after init, for backends that hand out
+ * units themselves (progO's parallel loop):
+ *   worker_unit()   - one run_unit() call, timed into ctx->stats;
+ *                     returns its status
+ *   worker_finish() - report (only if rc == 0), then teardown
+ */
+int worker_unit(const worker_ops_t *ops, worker_ctx_t *ctx);
+void worker_finish(const worker_ops_t *ops, worker_ctx_t *ctx, int rc);
+
+/**
+ * Work-size auto-calibration
+ * Runs one untimed warm-up unit (first-touch page faults, file creation),
+ * then times units for at least 50 ms, and sets the worker's unit count in
+ * *work so one worker runs for about target_seconds.
+ * Stores the measured seconds per unit in *unit_seconds.
+ * Returns the calibrated count, or -1 if the probe failed.
+ */
+int calibrate_work(const worker_ops_t *ops, double target_seconds,
+                   work_params_t *work, double *unit_seconds);
+
+#endif /* REGISTRY_H */
@@ -0,0 +1,449 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_signal.h"
+#include "MT25081_Part_B_timing.h"
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/**
+ *
+ * signal worker and its supervisor thread (see signal.h).
+ *
+ * Every worker keeps SIGUSR1 blocked outside the point where it waits for
+ * it, so a signal sent early stays pending instead of being lost or run at
+ * a random point; at most one is ever pending per worker because the
+ * supervisor waits for the acknowledgement before signalling it again.
+ *
+ * Only the supervisor started by signal_setup() sends the signals, so the
+ * worker needs it (--target-seconds is refused for it).
+ * ============================================================================
+ */
+
+#define SIGNAL_SIG SIGUSR1
+
+static const char *const send_names[] = {"kill", "tgkill", "pthread_kill"};
+static const char *const recv_names[] = {"handler", "sigwaitinfo", "signalfd"};
+static const char *const pattern_names[] = {"ping", "broadcast"};
+
+/**
+ * name_index() - Position of name in a table, -1 if absent
+ */
+static int name_index(const char *name, const char *const *names, int count) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(name, names[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int signal_send_parse(const char *name, signal_send_t *send) {
+    int i = name_index(name, send_names, 3);
+    if (i < 0) {
+        return -1;
+    }
+    *send = (signal_send_t)i;
+    return 0;
+}
+
+int signal_recv_parse(const char *name, signal_recv_t *recv) {
+    int i = name_index(name, recv_names, 3);
+    if (i < 0) {
+        return -1;
+    }
+    *recv = (signal_recv_t)i;
+    return 0;
+}
+
+int signal_pattern_parse(const char *name, signal_pattern_t *pattern) {
+    int i = name_index(name, pattern_names, 2);
+    if (i < 0) {
+        return -1;
+    }
+    *pattern = (signal_pattern_t)i;
+    return 0;
+}
+
+const char *signal_send_name(signal_send_t send) {
+    return send_names[send];
+}
+
+const char *signal_recv_name(signal_recv_t recv) {
+    return recv_names[recv];
+}
+
+const char *signal_pattern_name(signal_pattern_t pattern) {
+    return pattern_names[pattern];
+}
+
+/**
+ * futex_wait_change() - Sleeps until *word != seen (process-shared futex)
+ */
+static void futex_wait_change(int *word, int seen) {
+    while (__atomic_load_n(word, __ATOMIC_ACQUIRE) == seen) {
+        syscall(SYS_futex, word, FUTEX_WAIT, seen, NULL, NULL, 0);
+    }
+}
+
+/**
+ * futex_add_wake() - Adds 1 to *word and wakes its waiters
+ */
+static void futex_add_wake(int *word) {
+    __atomic_add_fetch(word, 1, __ATOMIC_RELEASE);
+    syscall(SYS_futex, word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+/**
+ * send_signal() - SIGUSR1 to one worker with the configured call
+ */
+static int send_signal(signal_send_t send, const signal_slot_t *slot) {
+    switch (send) {
+    case SIGNAL_SEND_KILL:
+        return kill(slot->pid, SIGNAL_SIG);
+    case SIGNAL_SEND_TGKILL:
+        return (int)syscall(SYS_tgkill, slot->pid, slot->tid, SIGNAL_SIG);
+    default:
+        errno = pthread_kill(slot->thread, SIGNAL_SIG);
+        return errno == 0 ? 0 : -1;
+    }
+}
+
+/**
+ * Supervisor thread and its results (one supervisor per driver process)
+ */
+static struct {
+    pthread_t thread;
+    int running;
+    signal_shared_t *shared;
+    signal_send_t send;
+    signal_pattern_t pattern;
+    int rounds;
+    uint64_t send_ticks;      // Sum over all send calls
+    long long sends;
+    uint64_t *deliver;        // Per signal: send start -> worker ack
+    uint64_t *rtt;            // ping: per signal; broadcast: per round
+    long long rtt_count;
+} supervisor;
+
+/**
+ * await_acks() - Sleeps until the ack counter reaches target
+ */
+static void await_acks(signal_shared_t *shared, int target) {
+    int seen;
+    while ((seen = __atomic_load_n(&shared->acks, __ATOMIC_ACQUIRE)) < target) {
+        futex_wait_change(&shared->acks, seen);
+    }
+}
+
+/**
+ * timed_send() - send_signal() with its cost added to send_ticks
+ */
+static void timed_send(const signal_slot_t *slot) {
+    uint64_t t0 = timing_now();
+    if (send_signal(supervisor.send, slot) != 0) {
+        perror("signal supervisor: send");
+        exit(EXIT_FAILURE);
+    }
+    supervisor.send_ticks += timing_now() - t0;
+    supervisor.sends++;
+}
+
+static void *supervisor_thread(void *arg) {
+    (void)arg;
+    signal_shared_t *shared = supervisor.shared;
+    int n = shared->parties;
+
+    // The supervisor never consumes SIGUSR1 itself
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGNAL_SIG);
+    pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+    int seen;
+    while ((seen = __atomic_load_n(&shared->registered, __ATOMIC_ACQUIRE)) < n) {
+        futex_wait_change(&shared->registered, seen);
+    }
+
+    int target = 0;
+    long long k = 0;
+    for (int r = 0; r < supervisor.rounds; r++) {
+        if (supervisor.pattern == SIGNAL_PATTERN_PING) {
+            // PING: one round trip per worker, nothing else in flight
+            for (int i = 0; i < n; i++) {
+                uint64_t t0 = timing_now();
+                timed_send(&shared->slots[i]);
+                await_acks(shared, ++target);
+                uint64_t t1 = timing_now();
+                supervisor.rtt[supervisor.rtt_count++] = t1 - t0;
+                supervisor.deliver[k++] = shared->slots[i].ack_tick - t0;
+            }
+        } else {
+            // BROADCAST: signal the whole fleet, then collect every ack
+            uint64_t t0 = timing_now();
+            for (int i = 0; i < n; i++) {
+                timed_send(&shared->slots[i]);
+            }
+            target += n;
+            await_acks(shared, target);
+            supervisor.rtt[supervisor.rtt_count++] = timing_now() - t0;
+            for (int i = 0; i < n; i++) {
+                supervisor.deliver[k++] = shared->slots[i].ack_tick - t0;
+            }
+        }
+    }
+    return NULL;
+}
+
+int signal_setup(work_params_t *work, int num_workers, const char *tag) {
+    // kill addresses a single-threaded process, pthread_kill a thread of
+    // this process; hybrid workers are neither
+    int processes = work->model == WORKER_MODEL_PROCESSES;
+    int threads = work->model == WORKER_MODEL_THREADS;
+    if ((work->sig_send == SIGNAL_SEND_KILL && !processes) ||
+        (work->sig_send == SIGNAL_SEND_PTHREAD_KILL && !threads)) {
+        fprintf(stderr, "Error: --sig-send=%s cannot target %s; use %s\n",
+                signal_send_name(work->sig_send), processes ? "processes" : "threads",
+                processes ? "kill or tgkill" : threads ? "pthread_kill or tgkill" : "tgkill");
+        return -1;
+    }
+
+    signal_shared_t *shared = mmap(NULL, sizeof(signal_shared_t), PROT_READ | PROT_WRITE,
+                                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return -1;
+    }
+    shared->parties = num_workers;
+
+    long long signals = (long long)work->sig_rounds * num_workers;
+    memset(&supervisor, 0, sizeof(supervisor));
+    supervisor.shared = shared;
+    supervisor.send = work->sig_send;
+    supervisor.pattern = work->sig_pattern;
+    supervisor.rounds = work->sig_rounds;
+    supervisor.deliver = (uint64_t *)malloc(signals * sizeof(uint64_t));
+    supervisor.rtt = (uint64_t *)malloc(signals * sizeof(uint64_t));
+    if (supervisor.deliver == NULL || supervisor.rtt == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(supervisor.deliver);
+        free(supervisor.rtt);
+        munmap(shared, sizeof(signal_shared_t));
+        return -1;
+    }
+    int rc = pthread_create(&supervisor.thread, NULL, supervisor_thread, NULL);
+    if (rc != 0) {
+        fprintf(stderr, "Error: cannot create signal supervisor: %s\n", strerror(rc));
+        free(supervisor.deliver);
+        free(supervisor.rtt);
+        munmap(shared, sizeof(signal_shared_t));
+        return -1;
+    }
+    supervisor.running = 1;
+    work->signal = shared;
+    printf("[%s] SIGNAL send=%s recv=%s pattern=%s signals=%d\n",
+           tag, signal_send_name(work->sig_send), signal_recv_name(work->sig_recv),
+           signal_pattern_name(work->sig_pattern), work->sig_rounds);
+    return 0;
+}
+
+/**
+ * compare_ticks() - qsort() order for uint64_t
+ */
+static int compare_ticks(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * ticks_summary() - Sorts v and returns its mean; p50/p99/max through pointers (us)
+ */
+static double ticks_summary(uint64_t *v, long long n, double *p50, double *p99, double *max) {
+    *p50 = *p99 = *max = 0.0;
+    if (n == 0) {
+        return 0.0;
+    }
+    qsort(v, (size_t)n, sizeof(uint64_t), compare_ticks);
+    uint64_t sum = 0;
+    for (long long i = 0; i < n; i++) {
+        sum += v[i];
+    }
+    *p50 = timing_ticks_to_ns(v[n / 2]) / 1000.0;
+    *p99 = timing_ticks_to_ns(v[(long long)(0.99 * (n - 1))]) / 1000.0;
+    *max = timing_ticks_to_ns(v[n - 1]) / 1000.0;
+    return timing_ticks_to_ns(sum) / 1000.0 / n;
+}
+
+/**
+ * supervisor_stop() - Joins the supervisor and prints the SIGNAL_RESULT line;
+ * no-op if signal_setup() did not start it
+ */
+static void supervisor_stop(const char *tag, const work_params_t *work) {
+    if (!supervisor.running) {
+        return;
+    }
+    pthread_join(supervisor.thread, NULL);
+    supervisor.running = 0;
+
+    long long signals = (long long)supervisor.rounds * supervisor.shared->parties;
+    double d50, d99, dmax, r50, r99, rmax;
+    double dmean = ticks_summary(supervisor.deliver, signals, &d50, &d99, &dmax);
+    double rmean = ticks_summary(supervisor.rtt, supervisor.rtt_count, &r50, &r99, &rmax);
+    printf("[%s] SIGNAL_RESULT send=%s recv=%s pattern=%s workers=%d signals=%lld "
+           "send_ns=%.1f deliver_mean_us=%.2f deliver_p50_us=%.2f deliver_p99_us=%.2f "
+           "deliver_max_us=%.2f rtt_mean_us=%.2f rtt_p99_us=%.2f rtt_max_us=%.2f\n",
+           tag, signal_send_name(work->sig_send), signal_recv_name(work->sig_recv),
+           signal_pattern_name(work->sig_pattern), supervisor.shared->parties, signals,
+           supervisor.sends ? timing_ticks_to_ns(supervisor.send_ticks) / supervisor.sends : 0.0,
+           dmean, d50, d99, dmax, rmean, r99, rmax);
+    fflush(stdout);
+    free(supervisor.deliver);
+    free(supervisor.rtt);
+    supervisor.deliver = supervisor.rtt = NULL;
+}
+
+void signal_cleanup(work_params_t *work, const char *tag) {
+    supervisor_stop(tag, work);
+    if (work->signal != NULL) {
+        munmap(work->signal, sizeof(signal_shared_t));
+        work->signal = NULL;
+    }
+}
+
+/**
+ * Handler-mode acknowledgement target of the calling thread (NULL outside a worker)
+ */
+static __thread signal_shared_t *handler_shared;
+static __thread signal_slot_t *handler_slot;
+
+/**
+ * acknowledge() - Stamps the slot and bumps the shared ack counter
+ */
+static void acknowledge(signal_shared_t *shared, signal_slot_t *slot) {
+    slot->ack_tick = timing_now();
+    futex_add_wake(&shared->acks);
+}
+
+static void signal_handler(int sig) {
+    (void)sig;
+    if (handler_shared != NULL) {
+        acknowledge(handler_shared, handler_slot);
+    }
+}
+
+/**
+ * Per-worker state
+ */
+typedef struct {
+    signal_shared_t *shared;     // signal_setup()'s state
+    signal_slot_t *slot;
+    sigset_t set;                // {SIGUSR1}
+    sigset_t old_mask;           // Mask before init, restored by teardown
+    sigset_t wait_mask;          // handler: mask inside sigsuspend()
+    int fd;                      // signalfd, -1 otherwise
+} signal_state_t;
+
+static int signal_init(worker_ctx_t *ctx) {
+    const work_params_t *work = ctx->work;
+    signal_shared_t *shared = work->signal;
+    if (shared == NULL || ctx->worker_id < 1 || ctx->worker_id > shared->parties) {
+        fprintf(stderr, "signal worker %d: no shared state (signal_setup() not run)\n",
+                ctx->worker_id);
+        return -1;
+    }
+    signal_state_t *sg = (signal_state_t *)calloc(1, sizeof(signal_state_t));
+    if (sg == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    sg->fd = -1;
+
+    // Block SIGUSR1 first, so nothing is delivered before we wait for it
+    sigemptyset(&sg->set);
+    sigaddset(&sg->set, SIGNAL_SIG);
+    pthread_sigmask(SIG_BLOCK, &sg->set, &sg->old_mask);
+
+    if (work->sig_recv == SIGNAL_RECV_HANDLER) {
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = signal_handler;
+        sigemptyset(&sa.sa_mask);
+        sigaction(SIGNAL_SIG, &sa, NULL);
+        pthread_sigmask(SIG_BLOCK, NULL, &sg->wait_mask);
+        sigdelset(&sg->wait_mask, SIGNAL_SIG);
+    } else if (work->sig_recv == SIGNAL_RECV_SIGNALFD) {
+        sg->fd = signalfd(-1, &sg->set, SFD_CLOEXEC);
+        if (sg->fd < 0) {
+            perror("signalfd");
+            pthread_sigmask(SIG_SETMASK, &sg->old_mask, NULL);
+            free(sg);
+            return -1;
+        }
+    }
+
+    sg->shared = shared;
+    sg->slot = &shared->slots[ctx->worker_id - 1];
+    sg->slot->pid = getpid();
+    sg->slot->tid = (int)syscall(SYS_gettid);
+    sg->slot->thread = pthread_self();
+    handler_shared = sg->shared;
+    handler_slot = sg->slot;
+    ctx->state = sg;
+
+    // Registered: the supervisor may signal this worker from now on
+    futex_add_wake(&shared->registered);
+    return 0;
+}
+
+static int signal_run_unit(worker_ctx_t *ctx) {
+    signal_state_t *sg = (signal_state_t *)ctx->state;
+    signal_recv_t recv = ctx->work->sig_recv;
+
+    if (recv == SIGNAL_RECV_HANDLER) {
+        // Returns -1/EINTR once the handler (which acknowledges) has run
+        sigsuspend(&sg->wait_mask);
+        return 0;
+    }
+    if (recv == SIGNAL_RECV_SIGWAITINFO) {
+        siginfo_t info;
+        while (sigwaitinfo(&sg->set, &info) < 0) {
+            if (errno != EINTR) {
+                perror("sigwaitinfo");
+                return -1;
+            }
+        }
+    } else {
+        struct signalfd_siginfo info;
+        if (read(sg->fd, &info, sizeof(info)) != (ssize_t)sizeof(info)) {
+            perror("signalfd read");
+            return -1;
+        }
+    }
+    acknowledge(sg->shared, sg->slot);
+    return 0;
+}
+
+static void signal_teardown(worker_ctx_t *ctx) {
+    signal_state_t *sg = (signal_state_t *)ctx->state;
+    if (sg->fd >= 0) {
+        close(sg->fd);
+    }
+    handler_shared = NULL;
+    handler_slot = NULL;
+    pthread_sigmask(SIG_SETMASK, &sg->old_mask, NULL);
+    free(sg);
+    ctx->state = NULL;
+}
+
+static void signal_report(const worker_ctx_t *ctx) {
+    unit_stats_print(ctx->tag, "SIGNAL_STATS", ctx->worker_id, &ctx->stats);
+}
+
+const worker_ops_t signal_worker_ops = {
+    WORKER_API_VERSION, "signal", "wait for one SIGUSR1 from the supervisor and acknowledge it",
+    signal_init, signal_run_unit, signal_teardown, signal_report
+};
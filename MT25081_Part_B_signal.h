@@ -0,0 +1,82 @@
+#ifndef SIGNAL_H
+#define SIGNAL_H
+
+#include <pthread.h>
+#include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_barrier.h"
+
+/**
+ * Signal delivery worker.
+ *
+ * A supervisor thread in the driver process signals the N workers with
+ * SIGUSR1 and waits for each to acknowledge through a futex in MAP_SHARED
+ * memory. One unit of a worker is one signal consumed and acknowledged.
+ *
+ *   work->sig_send    kill (process-directed, progA only), tgkill
+ *                     (thread-directed, both), pthread_kill (threads only)
+ *   work->sig_recv    handler    - SIGUSR1 handler run from sigsuspend()
+ *                     sigwaitinfo - synchronous wait, signal blocked
+ *                     signalfd    - read() from a signalfd, signal blocked
+ *   work->sig_pattern ping       - one worker at a time, one round trip each
+ *                     broadcast  - all N signalled, then all acks awaited
+ *
+ * After the backend returns the driver prints a "[tag] SIGNAL_RESULT ..."
+ * line: send_ns (cost of the send call), deliver_* (send start until the
+ * worker runs its acknowledgement, per signal) and rtt_* (ping: send start
+ * until the supervisor sees the ack; broadcast: first send until the last
+ * ack, i.e. the time to signal the whole fleet).
+ */
+
+/**
+ * Per-worker registration and last acknowledgement, one cache line each
+ */
+typedef struct {
+    int pid;                 // getpid() of the worker
+    int tid;                 // gettid() of the worker
+    pthread_t thread;        // pthread_self() (threads only)
+    uint64_t ack_tick;       // timing_now() at the last acknowledgement
+} __attribute__((aligned(64))) signal_slot_t;
+
+/**
+ * State shared by the supervisor and all workers (created before fork)
+ */
+typedef struct signal_shared {
+    int parties;                                 // Number of workers
+    int registered __attribute__((aligned(64))); // Workers ready to receive (futex)
+    int acks __attribute__((aligned(64)));       // Acknowledgements so far (futex)
+    signal_slot_t slots[BARRIER_MAX_PARTIES];    // Indexed by worker_id - 1
+} signal_shared_t;
+
+/**
+ * Parse "kill|tgkill|pthread_kill", "handler|sigwaitinfo|signalfd" and
+ * "ping|broadcast"; return -1 if unknown
+ */
+int signal_send_parse(const char *name, signal_send_t *send);
+int signal_recv_parse(const char *name, signal_recv_t *recv);
+int signal_pattern_parse(const char *name, signal_pattern_t *pattern);
+
+/**
+ * Names for the startup and result lines
+ */
+const char *signal_send_name(signal_send_t send);
+const char *signal_recv_name(signal_recv_t recv);
+const char *signal_pattern_name(signal_pattern_t pattern);
+
+/**
+ * Setup hook: checks that work->sig_send can address work->model's
+ * workers, maps the shared state for num_workers workers into work->signal,
+ * starts the supervisor thread (which waits until every worker has
+ * registered) and prints the "[tag] SIGNAL" line. Must run before the
+ * workers start. Returns -1 (reason on stderr) on failure.
+ */
+int signal_setup(work_params_t *work, int num_workers, const char *tag);
+
+/**
+ * Cleanup hook: joins the supervisor, prints the SIGNAL_RESULT line and
+ * unmaps the shared state from signal_setup()
+ */
+void signal_cleanup(work_params_t *work, const char *tag);
+
+extern const worker_ops_t signal_worker_ops;
+
+#endif /* SIGNAL_H */
@@ -0,0 +1,98 @@
+#define _GNU_SOURCE
+#include "MT25081_Part_B_timing.h"
+#include <stdio.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+/**
+ *
+ * Tick source selection and calibration for timing_now().
+ *
+ * clock_gettime(CLOCK_MONOTONIC) costs about 20-50 ns per call, which is too
+ * much to wrap around each pass of mem_worker or each I/O phase. Reading the
+ * TSC (or CNTVCT on aarch64) costs a few nanoseconds, but ticks only map to
+ * wall time if the counter runs at a constant rate: on x86 that is the
+ * "invariant TSC" bit (CPUID 0x80000007, EDX bit 8). Without it, timing
+ * falls back to clock_gettime and 1 tick = 1 ns.
+ * ============================================================================
+ */
+
+int timing_use_counter = 0;
+double timing_ns_per_tick = 1.0;
+static double overhead_ns = 0.0;
+
+uint64_t timing_monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * counter_available() - Whether a constant-rate hardware counter exists
+ */
+static int counter_available(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) {
+        return 0;
+    }
+    return (edx & (1u << 8)) != 0;   // Invariant TSC
+#elif defined(__aarch64__)
+    return 1;                        // Generic timer runs at CNTFRQ_EL0
+#else
+    return 0;
+#endif
+}
+
+void timing_init(void) {
+    timing_init_window(TIMING_CALIBRATION_NS);
+}
+
+void timing_init_window(uint64_t window_ns) {
+    timing_use_counter = counter_available();
+    timing_ns_per_tick = 1.0;
+
+    if (timing_use_counter) {
+        // Ticks elapsed over a fixed CLOCK_MONOTONIC window
+        uint64_t ns0 = timing_monotonic_ns();
+        uint64_t t0 = timing_now();
+        uint64_t ns1;
+        do {
+            ns1 = timing_monotonic_ns();
+        } while (ns1 - ns0 < window_ns);
+        uint64_t t1 = timing_now();
+
+        if (t1 > t0) {
+            timing_ns_per_tick = (double)(ns1 - ns0) / (double)(t1 - t0);
+        } else {
+            timing_use_counter = 0;   // Counter did not advance: fall back
+        }
+    }
+
+    // Cost of one timing_now() call, averaged over a burst
+    const int reps = 10000;
+    volatile uint64_t sink = 0;
+    uint64_t ns0 = timing_monotonic_ns();
+    for (int i = 0; i < reps; i++) {
+        sink += timing_now();
+    }
+    overhead_ns = (double)(timing_monotonic_ns() - ns0) / reps;
+    (void)sink;
+}
+
+const char *timing_source(void) {
+    if (!timing_use_counter) {
+        return "clock_gettime";
+    }
+#if defined(__aarch64__)
+    return "cntvct";
+#else
+    return "tsc";
+#endif
+}
+
+double timing_overhead_ns(void) {
+    return overhead_ns;
+}
@@ -0,0 +1,92 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * Low-overhead timing for hot-path instrumentation.
+ *
+ * timing_now() reads a raw tick counter:
+ *   - x86-64:  RDTSC, when CPUID reports an invariant TSC
+ *   - aarch64: CNTVCT_EL0 (the generic timer's virtual count)
+ *   - otherwise: CLOCK_MONOTONIC in nanoseconds (1 tick = 1 ns)
+ *
+ * timing_init() picks the source and calibrates ticks against
+ * CLOCK_MONOTONIC, so ticks convert to nanoseconds with timing_ticks_to_ns().
+ * Call it once at startup, before fork() or pthread_create(); children and
+ * threads inherit the calibration.
+ */
+
+extern int timing_use_counter;      // 1 if timing_now() reads TSC/CNTVCT
+extern double timing_ns_per_tick;   // Calibrated tick length in nanoseconds
+
+#define TIMING_CALIBRATION_NS 20000000ULL      // timing_init(): 20 ms window
+#define TIMING_QUICK_CALIBRATION_NS 1000000ULL // Startup runs: 1 ms window
+
+/**
+ * Selects the tick source and calibrates it against CLOCK_MONOTONIC over
+ * TIMING_CALIBRATION_NS (about 20 ms).
+ */
+void timing_init(void);
+
+/**
+ * timing_init() with a calibration window of window_ns. A shorter window
+ * starts faster but converts ticks less precisely (about 1e-4 relative
+ * error at 1 ms); for runs that only measure their own startup.
+ */
+void timing_init_window(uint64_t window_ns);
+
+/**
+ * Returns a short name for the tick source: "tsc", "cntvct" or "clock_gettime".
+ */
+const char *timing_source(void);
+
+/**
+ * Measured cost of one timing_now() call in nanoseconds (set by timing_init()).
+ */
+double timing_overhead_ns(void);
+
+/**
+ * CLOCK_MONOTONIC in nanoseconds: the calibration reference, and a time
+ * base shared by all processes (usable before timing_init()).
+ */
+uint64_t timing_monotonic_ns(void);
+
+/**
+ * timing_now() - Current tick count (see file comment for the source)
+ */
+static inline uint64_t timing_now(void) {
+    if (timing_use_counter) {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#endif
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * timing_ticks_to_ns() - Converts a tick delta to nanoseconds
+ */
+static inline double timing_ticks_to_ns(uint64_t ticks) {
+    return (double)ticks * timing_ns_per_tick;
+}
+
+/**
+ * timing_ticks_to_s() - Converts a tick delta to seconds
+ */
+static inline double timing_ticks_to_s(uint64_t ticks) {
+    return (double)ticks * timing_ns_per_tick / 1e9;
+}
+
+#endif /* TIMING_H */
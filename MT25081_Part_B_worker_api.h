@@ -0,0 +1,76 @@
+#ifndef WORKER_API_H
+#define WORKER_API_H
+
+#include <stdint.h>
+
+/**
+ * Worker plugin interface.
+ *
+ * A worker is a table of callbacks. The drivers (progA children, progB
+ * threads) run every worker, built-in or plugin, the same way:
+ *
+ *   init(ctx)                  - once, allocate per-worker state (optional)
+ *   run_unit(ctx) x ctx->units - one unit of work, timed by the driver
+ *   report(ctx)                - once, print results (optional; the default
+ *                                prints a "[tag] UNIT_STATS ..." line)
+ *   teardown(ctx)              - once, free per-worker state (optional)
+ *
+ * A plugin is a shared object that exports a worker_ops_t named
+ * pa01_worker_ops (WORKER_PLUGIN_SYMBOL); it only needs this header:
+ *
+ *   const worker_ops_t pa01_worker_ops = {
+ *       WORKER_API_VERSION, "mykernel", "what one unit does",
+ *       my_init, my_run_unit, my_teardown, NULL
+ *   };
+ *
+ *   gcc -O2 -fPIC -shared -o mykernel.so mykernel.c
+ *   ./progA mykernel 4 --worker-lib=./mykernel.so --units=500
+ *
+ * See MT25081_Part_B_plugin_example.c.
+ */
+
+#define WORKER_API_VERSION 1
+#define WORKER_PLUGIN_SYMBOL "pa01_worker_ops"
+
+struct work_params;   // Built-in work sizes (workers.h); opaque to plugins
+
+/**
+ * Per-unit timings of one worker, in timing_now() ticks (see timing.h).
+ * A unit is one run_unit() call (an outer cpu iteration, a mem pass, ...).
+ */
+typedef struct {
+    int units;
+    uint64_t total_ticks;
+    uint64_t min_ticks;
+    uint64_t max_ticks;
+} unit_stats_t;
+
+/**
+ * Per-worker context, owned by the driver and passed to every callback
+ */
+typedef struct {
+    const char *tag;                 // Output prefix: "progA" or "progB"
+    int worker_id;                   // Worker number (1..N)
+    int units;                       // Number of run_unit() calls to make
+    const char *arg;                 // --worker-arg value, or NULL
+    const struct work_params *work;  // Built-in work sizes (opaque to plugins)
+    double ns_per_tick;              // Converts stats ticks to nanoseconds
+    unit_stats_t stats;              // Per-unit timings, filled by the driver
+    void *state;                     // Worker-private state (init/teardown)
+} worker_ctx_t;
+
+/**
+ * Worker callbacks. init/run_unit return 0 on success, -1 on failure
+ * (the worker then stops and its process/thread reports the error).
+ */
+typedef struct {
+    int api_version;                           // WORKER_API_VERSION
+    const char *name;                          // Worker type on the command line
+    const char *description;                   // What one unit does
+    int (*init)(worker_ctx_t *ctx);            // Optional
+    int (*run_unit)(worker_ctx_t *ctx);        // Required
+    void (*teardown)(worker_ctx_t *ctx);       // Optional
+    void (*report)(const worker_ctx_t *ctx);   // Optional
+} worker_ops_t;
+
+#endif /* WORKER_API_H */
@@ -1,14 +1,18 @@
+#define _GNU_SOURCE
 #include "MT25081_Part_B_workers.h"
+#include "MT25081_Part_B_timing.h"
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
 
 /**
  * 
  * These three worker functions represent different types of computational
  * workloads commonly found in real applications:
  * 
- * 1. cpu_worker()  - CPU-bound: Intensive mathematical calculations
- * 2. mem_worker()  - Memory-bound: Large data structure access patterns
- * 3. io_worker()   - I/O-bound: Disk read/write operations
+ * 1. cpu_worker_ops - CPU-bound: Intensive mathematical calculations
+ * 2. mem_worker_ops - Memory-bound: Large data structure access patterns
+ * 3. io_worker_ops  - I/O-bound: Disk read/write operations
  * 
  * CPU and Memory workers execute CPU_MEM_LOOP_COUNT times.
  * I/O worker executes IO_LOOP_COUNT times (reduced for practical benchmarking).
@@ -19,139 +23,461 @@
  */
 
 /**
- * cpu_worker() - CPU-intensive workload
- * 
- * WHAT IT DOES:
- *   Performs mathematical approximation of PI using the Leibniz formula.
- *   This creates sustained CPU load without significant memory or I/O demands.
- 
- */
-void cpu_worker(void) {
-    volatile double pi = 0.0;      // Volatile prevents compiler optimization
-    volatile int i;                // Volatile loop counter
-    
-    // Outer loop: CPU_MEM_LOOP_COUNT times (1000 iterations from roll number 25081)
-    // Each iteration completes the inner approximation loop
-    for (int iter = 0; iter < CPU_MEM_LOOP_COUNT; iter++) {
-        // Inner loop: 1 million iterations per outer loop iteration
-        // Applies formula to approximate PI
-        for (i = 0; i < 1000000; i++) {
-            if (i % 2 == 0) {
-                pi += 1.0 / (2.0 * i + 1.0);  // Add term for even indices
-            } else {
-                pi -= 1.0 / (2.0 * i + 1.0);  // Subtract term for odd indices
-            }
+ * HOT KERNELS - Multiversioned inner loops
+ *
+ * The inner loops of the three workers are compiled once per x86-64
+ * micro-architecture level with GCC target_clones. The dynamic loader runs
+ * an ifunc resolver at startup that binds each kernel to the best clone for
+ * the running CPU, so one portable binary uses AVX2/FMA (v3) or AVX-512 (v4)
+ * code where available without -march=native.
+ *
+ * Kernels return their result instead of writing volatile locals, so each
+ * clone can keep its accumulator in registers; the workers consume the result
+ * through DO_NOT_OPTIMIZE() (see workers.h).
+ */
+#if PA01_MULTIVERSION
+#define HOT_KERNEL __attribute__((target_clones("default", "arch=x86-64-v2", \
+                                                "arch=x86-64-v3", "arch=x86-64-v4")))
+#else
+#define HOT_KERNEL
+#endif
+
+/**
+ * leibniz_kernel() - Adds terms [0, terms) of the Leibniz series to acc
+ */
+HOT_KERNEL
+double leibniz_kernel(double acc, int terms) {
+    for (int i = 0; i < terms; i++) {
+        if (i % 2 == 0) {
+            acc += 1.0 / (2.0 * i + 1.0);  // Add term for even indices
+        } else {
+            acc -= 1.0 / (2.0 * i + 1.0);  // Subtract term for odd indices
         }
     }
-    // Final approximation: pi ≈ 4 * (calculated value)
-    // But we don't need to compute it - the loop work is what matters
+    return acc;
 }
 
 /**
- * mem_worker() - Memory-intensive workload
- * 
- * WHAT IT DOES:
- *   Allocates large memory blocks and performs both sequential and random
- *   access patterns to stress memory bandwidth and cache subsystem.
+ * mem_write_sweep() - Writes one int every 64 elements (256 bytes)
+ */
+HOT_KERNEL
+void mem_write_sweep(int *array, size_t array_size, int iter) {
+    for (size_t i = 0; i < array_size; i += 64) {
+        array[i] = i + iter;  // Write different value each iteration
+    }
+}
 
+/**
+ * mem_read_sweep() - Reads one int every 256 elements (1 KB) and sums them
  */
-void mem_worker(void) {
-    // Allocate 200MB of heap memory (increased from 100MB for better measurement)
-    // Size calculation: 200 * 1024 * 1024 / 4 bytes per int ≈ 52.4 million integers
-    size_t array_size = 200 * 1024 * 1024 / sizeof(int);
-    int *array = (int *)malloc(array_size * sizeof(int));
-    
-    // Validate memory allocation
-    if (array == NULL) {
-        fprintf(stderr, "Memory allocation failed\n");
-        return;
+HOT_KERNEL
+int mem_read_sweep(const int *array, size_t array_size) {
+    int sum = 0;
+    for (size_t i = 0; i < array_size; i += 256) {
+        sum += array[i];
     }
+    return sum;
+}
+
+/**
+ * buffer_checksum() - Sums the bytes of an I/O buffer (read-back verification)
+ */
+HOT_KERNEL
+unsigned long buffer_checksum(const unsigned char *buffer, size_t len) {
+    unsigned long sum = 0;
+    for (size_t i = 0; i < len; i++) {
+        sum += buffer[i];
+    }
+    return sum;
+}
+
+/**
+ * kernel_isa_level() - Reports which clone the ifunc resolvers selected
+ *
+ * Mirrors GCC's resolver priority: the highest level the CPU supports wins.
+ */
+const char *kernel_isa_level(void) {
+#if PA01_MULTIVERSION
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("x86-64-v4")) {
+        return "x86-64-v4";
+    }
+    if (__builtin_cpu_supports("x86-64-v3")) {
+        return "x86-64-v3";
+    }
+    if (__builtin_cpu_supports("x86-64-v2")) {
+        return "x86-64-v2";
+    }
+    return "default (x86-64)";
+#else
+    return "portable (multiversioning disabled)";
+#endif
+}
+
+/**
+ * unit_stats_add() - Records the duration of one work unit (in ticks)
+ */
+void unit_stats_add(unit_stats_t *stats, uint64_t ticks) {
+    if (stats->units == 0 || ticks < stats->min_ticks) {
+        stats->min_ticks = ticks;
+    }
+    if (ticks > stats->max_ticks) {
+        stats->max_ticks = ticks;
+    }
+    stats->total_ticks += ticks;
+    stats->units++;
+}
+
+/**
+ * unit_stats_print() - Prints per-unit timings as a "[tag] <name> ..." line
+ *
+ * Raw ticks are printed with the calibrated ns_per_tick of this worker's
+ * timer, so reports can be converted without re-running calibration.
+ */
+void unit_stats_print(const char *tag, const char *name, int worker_id, const unit_stats_t *stats) {
+    double mean_ns = stats->units ? timing_ticks_to_ns(stats->total_ticks) / stats->units : 0.0;
+    printf("[%s] %s worker=%d units=%d total_ticks=%llu min_ticks=%llu max_ticks=%llu "
+           "mean_ns=%.1f timer=%s ns_per_tick=%.6f\n",
+           tag, name, worker_id, stats->units,
+           (unsigned long long)stats->total_ticks, (unsigned long long)stats->min_ticks,
+           (unsigned long long)stats->max_ticks, mean_ns,
+           timing_source(), timing_ns_per_tick);
+    fflush(stdout);
+}
+
+/**
+ * elapsed_since() - Seconds elapsed since tick count start (see timing.h)
+ */
+static double elapsed_since(uint64_t start) {
+    return timing_ticks_to_s(timing_now() - start);
+}
+
+/**
+ * I/O worker state: one open file and its per-phase times
+ */
+typedef struct {
+    io_mode_t mode;
+    FILE *fp;                // Kept open across passes in prealloc mode only
+    char filename[64];
+    char buffer[4096];       // Standard page size buffer for I/O
+    io_stats_t stats;
+} io_state_t;
+
+/**
+ * io_open() - Names the worker's file and, in prealloc mode, opens it once
+ *             and reserves all 10MB of extents up front
+ */
+static int io_open(io_state_t *io, io_mode_t mode) {
+    memset(&io->stats, 0, sizeof(io->stats));
+    io->mode = mode;
+    io->fp = NULL;
+    
+    // One file per worker (process or thread) so workers do not truncate
+    // or remove each other's file mid-pass
+    snprintf(io->filename, sizeof(io->filename), "io_worker_temp_file_%ld.txt",
+             (long)syscall(SYS_gettid));
+    
+    // Initialize buffer with test data
+    memset(io->buffer, 'A', sizeof(io->buffer));  // Fill with 'A' characters
     
-    // Repeat CPU_MEM_LOOP_COUNT times (1000 iterations) to create sustained memory pressure
-    for (int iter = 0; iter < CPU_MEM_LOOP_COUNT; iter++) {
-        // PHASE 1: Sequential writes to all memory pages
-        // Stride of 64 bytes = cache line size (forces memory access, not cache hits)
-        // This ensures all allocated memory is physically resident
-        for (size_t i = 0; i < array_size; i += 64) {  // 64-byte cache line stride
-            array[i] = i + iter;  // Write different value each iteration
+    // ===== PREALLOCATION (prealloc mode only) =====
+    if (mode == IO_MODE_PREALLOC) {
+        const size_t file_size = (size_t)IO_WRITES_PER_PASS * sizeof(io->buffer);
+        uint64_t t0 = timing_now();
+        io->fp = fopen(io->filename, "w+");
+        if (io->fp == NULL) {
+            fprintf(stderr, "Failed to open file for writing\n");
+            return -1;
         }
-        
-        // PHASE 2: Random read pattern to stress cache misses
-        // Stride of 256 bytes = 4 cache lines apart
-        // This creates unpredictable access patterns that defeat prefetch
-        for (size_t i = 0; i < array_size; i += 256) {  // 256-byte stride
-            volatile int val = array[i];  // Read value (volatile prevents optimization)
-            (void)val;                    // Mark as used to prevent compiler elimination
+        int fd = fileno(io->fp);
+        // fallocate() may be unsupported (e.g. some tmpfs/NFS); posix_fallocate() emulates it
+        if (fallocate(fd, 0, 0, (off_t)file_size) != 0 &&
+            posix_fallocate(fd, 0, (off_t)file_size) != 0) {
+            fprintf(stderr, "Failed to preallocate file\n");
+            fclose(io->fp);
+            remove(io->filename);
+            return -1;
         }
+        fsync(fd);
+        io->stats.alloc_s = elapsed_since(t0);
     }
-    
-    // Free allocated memory
-    free(array);
+    return 0;
 }
 
 /**
- * io_worker() - I/O-intensive workload
- * 
- * WHAT IT DOES:
- *   Performs repeated disk write and read operations to stress the I/O subsystem.
- *   Each iteration writes 10MB of data to disk, then reads it back.
- *   Repeats LOOP_COUNT times (1000 iterations) = 10GB total I/O.
- 
- */
-void io_worker(void) {
-    // Use /tmp for temporary file (usually fast: ramdisk, local disk, or SSD)
-    const char *filename = "io_worker_temp_file.txt";
-    char buffer[4096];              // Standard page size buffer for I/O
+ * io_pass() - One 10MB write, fsync and verified read-back pass
+ */
+static int io_pass(io_state_t *io) {
+    char *buffer = io->buffer;
     size_t bytes_written;
+    uint64_t t0;
     
-    // Initialize buffer with test data
-    memset(buffer, 'A', sizeof(buffer));  // Fill with 'A' characters
-    
-    // Main I/O loop: IO_LOOP_COUNT iterations (reduced for practical benchmarking)
-    for (int iter = 0; iter < IO_LOOP_COUNT; iter++) {
-        
-        // ===== WRITE PHASE =====
+    // ===== WRITE PHASE =====
+    t0 = timing_now();
+    if (io->mode == IO_MODE_TRUNCATE) {
         // Open file for writing (truncate if exists)
-        FILE *fp = fopen(filename, "w");
-        if (fp == NULL) {
+        io->fp = fopen(io->filename, "w");
+        if (io->fp == NULL) {
             fprintf(stderr, "Failed to open file for writing\n");
-            return;
+            return -1;
         }
-        
-        // Write 10MB of data to file (2500 writes × 4KB = 10MB)
-        for (int i = 0; i < 2500; i++) {
-            bytes_written = fwrite(buffer, 1, sizeof(buffer), fp);
-            if (bytes_written != sizeof(buffer)) {
-                fprintf(stderr, "Write error\n");
-                fclose(fp);
-                return;
-            }
+    } else {
+        // Overwrite in place from the start of the preallocated file
+        rewind(io->fp);
+    }
+    io->stats.open_s += elapsed_since(t0);
+    
+    // Write 10MB of data to file (2500 writes × 4KB = 10MB)
+    t0 = timing_now();
+    for (int i = 0; i < IO_WRITES_PER_PASS; i++) {
+        bytes_written = fwrite(buffer, 1, sizeof(io->buffer), io->fp);
+        if (bytes_written != sizeof(io->buffer)) {
+            fprintf(stderr, "Write error\n");
+            fclose(io->fp);
+            io->fp = NULL;
+            return -1;
         }
-        // Close file to ensure data is flushed to disk
-        fflush(fp);
-        int fd = fileno(fp);
-        fsync(fd);
-        fclose(fp);
-        
-        // ===== READ PHASE =====
-        // Open file for reading to stress I/O subsystem
-        fp = fopen(filename, "r");
-        if (fp == NULL) {
+    }
+    fflush(io->fp);
+    io->stats.write_s += elapsed_since(t0);
+    
+    // Flush to disk (in place: no extent allocation in prealloc mode)
+    t0 = timing_now();
+    fsync(fileno(io->fp));
+    if (io->mode == IO_MODE_TRUNCATE) {
+        fclose(io->fp);
+        io->fp = NULL;
+    }
+    io->stats.fsync_s += elapsed_since(t0);
+    
+    // ===== READ PHASE =====
+    // Open file for reading to stress I/O subsystem
+    t0 = timing_now();
+    if (io->mode == IO_MODE_TRUNCATE) {
+        io->fp = fopen(io->filename, "r");
+        if (io->fp == NULL) {
             fprintf(stderr, "Failed to open file for reading\n");
-            return;
-        }
-        
-        // Read entire file back into memory to stress I/O bandwidth
-        while (fread(buffer, 1, sizeof(buffer), fp) > 0) {
-            // Just read the data, don't process it
-            volatile char c = buffer[0];  // Volatile prevents optimization
-            (void)c;                      // Mark as used
+            return -1;
         }
-        // Close file after reading
-        fclose(fp);
+    } else {
+        rewind(io->fp);
+    }
+    
+    // Read entire file back into memory to stress I/O bandwidth
+    // and verify it: every byte written was 'A'
+    size_t bytes_read = 0, n;
+    unsigned long checksum = 0;
+    while ((n = fread(buffer, 1, sizeof(io->buffer), io->fp)) > 0) {
+        checksum += buffer_checksum((const unsigned char *)buffer, n);
+        bytes_read += n;
+    }
+    // Close file after reading (prealloc mode keeps it open)
+    if (io->mode == IO_MODE_TRUNCATE) {
+        fclose(io->fp);
+        io->fp = NULL;
+    }
+    io->stats.read_s += elapsed_since(t0);
+    
+    if (checksum != (unsigned long)'A' * bytes_read) {
+        fprintf(stderr, "Read verification failed\n");
+    }
+    memset(buffer, 'A', sizeof(io->buffer));  // Restore the write pattern
+    io->stats.passes++;
+    return 0;
+}
+
+/**
+ * io_close() - Closes the file (prealloc mode) and removes it
+ */
+static void io_close(io_state_t *io) {
+    if (io->fp != NULL) {
+        fclose(io->fp);
+        io->fp = NULL;
     }
     
     // Cleanup: Remove temporary file after all iterations complete
-    remove(filename);
+    remove(io->filename);
+}
+
+/**
+ * io_stats_print() - Prints one worker's per-phase I/O times
+ *
+ * The "[tag] IO_STATS ..." line is key=value so scripts can parse it.
+ */
+void io_stats_print(const char *tag, int worker_id, io_mode_t mode, const io_stats_t *stats) {
+    printf("[%s] IO_STATS worker=%d mode=%s passes=%d alloc_s=%.4f open_s=%.4f "
+           "write_s=%.4f fsync_s=%.4f read_s=%.4f timer=%s ns_per_tick=%.6f\n",
+           tag, worker_id, mode == IO_MODE_PREALLOC ? "prealloc" : "truncate",
+           stats->passes, stats->alloc_s, stats->open_s,
+           stats->write_s, stats->fsync_s, stats->read_s,
+           timing_source(), timing_ns_per_tick);
+    fflush(stdout);
+}
+
+/**
+ * BUILT-IN WORKERS AS PLUGIN-STYLE OPS
+ *
+ * The drivers run cpu, mem and io through the same worker_ops_t callbacks
+ * as a dlopen()ed plugin (see worker_api.h and registry.c). The driver
+ * times each run_unit() call into ctx->stats; mem and io additionally keep
+ * their per-sweep/per-phase timings in their state for their report lines.
+ */
+
+/**
+ * C-kernel adapters with the tkernel_t signatures, so a worker resolves
+ * its kernel once in init and run_unit() makes one indirect call
+ */
+static double c_leibniz(int terms) {
+    return leibniz_kernel(0.0, terms);
+}
+
+static void c_mem_write(void *array, size_t bytes, int iter) {
+    mem_write_sweep((int *)array, bytes / sizeof(int), iter);
+}
+
+static long long c_mem_read(const void *array, size_t bytes) {
+    return mem_read_sweep((const int *)array, bytes / sizeof(int));
+}
+
+/**
+ * cpu: one unit is one outer iteration (1,000,000 Leibniz terms)
+ */
+typedef struct {
+    double (*kernel)(int terms);   // C kernel or a --kernel variant
+} cpu_state_t;
+
+static int cpu_init(worker_ctx_t *ctx) {
+    cpu_state_t *cpu = (cpu_state_t *)malloc(sizeof(cpu_state_t));
+    if (cpu == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    cpu->kernel = ctx->work->kernel ? ctx->work->kernel->cpu : c_leibniz;
+    ctx->state = cpu;
+    return 0;
+}
+
+static int cpu_run_unit(worker_ctx_t *ctx) {
+    const cpu_state_t *cpu = (const cpu_state_t *)ctx->state;
+    double pi = cpu->kernel(1000000);
+    DO_NOT_OPTIMIZE(pi);
+    return 0;
+}
+
+static void cpu_teardown(worker_ctx_t *ctx) {
+    free(ctx->state);
+    ctx->state = NULL;
+}
+
+static void cpu_report(const worker_ctx_t *ctx) {
+    unit_stats_print(ctx->tag, "CPU_STATS", ctx->worker_id, &ctx->stats);
+}
+
+const worker_ops_t cpu_worker_ops = {
+    WORKER_API_VERSION, "cpu", "1,000,000 Leibniz terms",
+    cpu_init, cpu_run_unit, cpu_teardown, cpu_report
+};
+
+/**
+ * mem: one unit is a write sweep plus a read sweep over work->mem_bytes
+ */
+typedef struct {
+    void *array;
+    size_t bytes;
+    int pass;
+    void (*write_sweep)(void *array, size_t bytes, int iter);   // C kernel or --kernel
+    long long (*read_sweep)(const void *array, size_t bytes);
+    unit_stats_t write_stats;
+    unit_stats_t read_stats;
+} mem_state_t;
+
+static int mem_init(worker_ctx_t *ctx) {
+    mem_state_t *mem = (mem_state_t *)calloc(1, sizeof(mem_state_t));
+    if (mem == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    mem->bytes = ctx->work->mem_bytes / sizeof(int) * sizeof(int);
+    mem->array = malloc(mem->bytes);
+    if (mem->array == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(mem);
+        return -1;
+    }
+    const tkernel_t *variant = ctx->work->kernel;
+    mem->write_sweep = variant ? variant->mem_write : c_mem_write;
+    mem->read_sweep = variant ? variant->mem_read : c_mem_read;
+    ctx->state = mem;
+    return 0;
+}
+
+static int mem_run_unit(worker_ctx_t *ctx) {
+    mem_state_t *mem = (mem_state_t *)ctx->state;
+    
+    // PHASE 1: Sequential writes, PHASE 2: strided reads (see mem_write_sweep())
+    uint64_t t0 = timing_now();
+    mem->write_sweep(mem->array, mem->bytes, mem->pass++);
+    uint64_t t1 = timing_now();
+    long long sink = mem->read_sweep(mem->array, mem->bytes);
+    DO_NOT_OPTIMIZE(sink);
+    uint64_t t2 = timing_now();
+    
+    unit_stats_add(&mem->write_stats, t1 - t0);
+    unit_stats_add(&mem->read_stats, t2 - t1);
+    return 0;
+}
+
+static void mem_teardown(worker_ctx_t *ctx) {
+    mem_state_t *mem = (mem_state_t *)ctx->state;
+    free(mem->array);
+    free(mem);
+    ctx->state = NULL;
+}
+
+static void mem_report(const worker_ctx_t *ctx) {
+    const mem_state_t *mem = (const mem_state_t *)ctx->state;
+    unit_stats_print(ctx->tag, "MEM_WRITE_STATS", ctx->worker_id, &mem->write_stats);
+    unit_stats_print(ctx->tag, "MEM_READ_STATS", ctx->worker_id, &mem->read_stats);
+}
+
+const worker_ops_t mem_worker_ops = {
+    WORKER_API_VERSION, "mem", "one write and one read sweep over the array",
+    mem_init, mem_run_unit, mem_teardown, mem_report
+};
+
+/**
+ * io: one unit is one 10MB write/fsync/read pass in work->io_mode
+ */
+static int io_init(worker_ctx_t *ctx) {
+    io_state_t *io = (io_state_t *)malloc(sizeof(io_state_t));
+    if (io == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    if (io_open(io, ctx->work->io_mode) != 0) {
+        free(io);
+        return -1;
+    }
+    ctx->state = io;
+    return 0;
+}
+
+static int io_run_unit(worker_ctx_t *ctx) {
+    return io_pass((io_state_t *)ctx->state);
+}
+
+static void io_teardown(worker_ctx_t *ctx) {
+    io_close((io_state_t *)ctx->state);
+    free(ctx->state);
+    ctx->state = NULL;
+}
+
+static void io_report(const worker_ctx_t *ctx) {
+    const io_state_t *io = (const io_state_t *)ctx->state;
+    io_stats_print(ctx->tag, ctx->worker_id, io->mode, &io->stats);
 }
 
+const worker_ops_t io_worker_ops = {
+    WORKER_API_VERSION, "io", "one 10MB write/fsync/read pass",
+    io_init, io_run_unit, io_teardown, io_report
+};
@@ -5,26 +5,271 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <stdint.h>
+#include "MT25081_Part_B_worker_api.h"
+#include "MT25081_Part_B_kernels.h"
+#include "MT25081_Part_B_barrier.h"
 
 #define CPU_MEM_LOOP_COUNT 1000  // Original loop count for CPU and Memory workers
 #define IO_LOOP_COUNT 10         // Reduced loop count for I/O worker for practical benchmarking on WSL
+#define IO_WRITES_PER_PASS 2500   // 4KB writes per I/O pass (10MB file)
+#define MEM_ARRAY_BYTES (200UL * 1024 * 1024)  // Default mem worker footprint (200MB)
+#define BSP_SUPERSTEPS 1000       // Default bsp supersteps (compute slice + barrier)
+#define BSP_SLICE_TERMS 100000    // Default Leibniz terms per bsp compute slice
+#define IMB_ROUNDS 10             // Default imbalance rounds over the task set
+#define IMB_TASKS 1000            // Default tasks per imbalance round
+#define IMB_TASK_COST 20000       // Default mean task cost (Leibniz terms / 256 B swept)
+#define ATOMIC_BATCHES 1000       // Default atomic batches
+#define ATOMIC_BATCH_OPS 100000   // Default atomic operations per batch
+#define SIGNAL_ROUNDS 1000        // Default signals per signal worker
+#define FD_BATCHES 1000           // Default fdchurn batches
+#define FD_BATCH_CYCLES 1000      // Default open/dup/close cycles per fdchurn batch
+#define COW_BATCHES 100           // Default cow lookup batches
+#define COW_BATCH_LOOKUPS 1000000 // Default random table lookups per cow batch
+#define COW_DATASET_MB 256        // Default cow dataset size built before the workers start
+#define IDLE_SLEEPS 1             // Default idle worker sleeps
+#define IDLE_SLEEP_MS 100         // Default length of one idle sleep
 
 /**
- * CPU-intensive worker function
- * Performs complex mathematical calculations to stress the CPU
+ * Function multiversioning (GCC target_clones) for the hot kernels.
+ * Enabled for GCC >= 12 on x86-64 Linux; build with -DPA01_NO_MULTIVERSION
+ * to compile a single generic version of each kernel.
  */
-void cpu_worker(void);
+#if !defined(PA01_NO_MULTIVERSION) && defined(__GNUC__) && !defined(__clang__) && \
+    __GNUC__ >= 12 && defined(__x86_64__) && defined(__linux__)
+#define PA01_MULTIVERSION 1
+#else
+#define PA01_MULTIVERSION 0
+#endif
 
 /**
- * Memory-intensive worker function
- * Allocates and processes large arrays to stress the memory subsystem
+ * Optimizer barriers for benchmark loops (Google Benchmark's DoNotOptimize /
+ * ClobberMemory). An empty asm statement that "reads" a value forces the
+ * compiler to compute it, without the store-and-reload on every update that
+ * a volatile variable costs. CLOBBER_MEMORY() makes pending stores to memory
+ * (e.g. a write sweep's array) observable.
  */
-void mem_worker(void);
+#define DO_NOT_OPTIMIZE(value) __asm__ __volatile__("" : : "r,m"(value) : "memory")
+#define CLOBBER_MEMORY() __asm__ __volatile__("" : : : "memory")
 
 /**
- * I/O-intensive worker function
- * Performs disk read/write operations to stress I/O subsystem
+ * Hot kernels used by the workers (multiversioned, see workers.c)
  */
-void io_worker(void);
+double leibniz_kernel(double acc, int terms);
+void mem_write_sweep(int *array, size_t array_size, int iter);
+int mem_read_sweep(const int *array, size_t array_size);
+unsigned long buffer_checksum(const unsigned char *buffer, size_t len);
+
+/**
+ * Returns the name of the kernel clone selected for this CPU
+ * (e.g. "x86-64-v3"), for the drivers' startup report
+ */
+const char *kernel_isa_level(void);
+
+/**
+ * Records the duration of one work unit (in ticks) into unit_stats_t
+ * (defined in worker_api.h)
+ */
+void unit_stats_add(unit_stats_t *stats, uint64_t ticks);
+
+/**
+ * Prints unit timings as a "[tag] <name> worker=N ..." line, including
+ * the timer source and ns_per_tick for cycles-to-ns conversion
+ */
+void unit_stats_print(const char *tag, const char *name, int worker_id, const unit_stats_t *stats);
+
+/**
+ * File strategy for the I/O worker
+ * - IO_MODE_TRUNCATE: reopen with fopen("w") every pass (frees/reallocates extents)
+ * - IO_MODE_PREALLOC: open once, fallocate(), overwrite in place every pass
+ */
+typedef enum {
+    IO_MODE_TRUNCATE = 0,
+    IO_MODE_PREALLOC = 1
+} io_mode_t;
+
+/**
+ * Per-phase wall-clock times (seconds) of one I/O worker, summed over passes.
+ * alloc_s is the one-time fallocate() in prealloc mode; open_s includes
+ * the truncation in truncate mode.
+ */
+typedef struct {
+    int passes;
+    double alloc_s;
+    double open_s;
+    double write_s;
+    double fsync_s;
+    double read_s;
+} io_stats_t;
+
+/**
+ * Prints one worker's I/O phase times as a "[tag] IO_STATS ..." line
+ */
+void io_stats_print(const char *tag, int worker_id, io_mode_t mode, const io_stats_t *stats);
+
+/**
+ * Task cost distribution of the imbalance worker (mean cost work->imb_task_cost)
+ * - TASK_DIST_UNIFORM: uniform on [0, 2 * mean]
+ * - TASK_DIST_EXP:     exponential
+ * - TASK_DIST_PARETO:  Pareto, shape 1.5 (heavy tail, finite mean)
+ */
+typedef enum {
+    TASK_DIST_UNIFORM = 0,
+    TASK_DIST_EXP = 1,
+    TASK_DIST_PARETO = 2
+} task_dist_t;
+
+/**
+ * How the imbalance worker's tasks are handed out (OpenMP schedule kinds)
+ * - SCHEDULE_STATIC:  contiguous block of tasks/N per worker, no sharing
+ * - SCHEDULE_DYNAMIC: chunks of work->imb_chunk from a shared atomic counter
+ * - SCHEDULE_GUIDED:  chunks of remaining/N (at least work->imb_chunk)
+ */
+typedef enum {
+    SCHEDULE_STATIC = 0,
+    SCHEDULE_DYNAMIC = 1,
+    SCHEDULE_GUIDED = 2
+} schedule_t;
+
+/**
+ * Kernel an imbalance task runs for its cost: cost Leibniz terms (cpu), or
+ * a write+read sweep over cost * 256 bytes of a private buffer (mem)
+ */
+typedef enum {
+    TASK_KERNEL_CPU = 0,
+    TASK_KERNEL_MEM = 1
+} task_kernel_t;
+
+/**
+ * Operation, memory order and location of the atomic worker
+ * - ATOMIC_ORDER_ACQREL: acquire loads, release stores, acq_rel read-modify-writes
+ * - ATOMIC_LOC_SHARED:   one word for all workers; PRIVATE: one cache line each
+ */
+typedef enum {
+    ATOMIC_OP_LOAD = 0,
+    ATOMIC_OP_STORE = 1,
+    ATOMIC_OP_ADD = 2,
+    ATOMIC_OP_CAS = 3
+} atomic_op_t;
+
+typedef enum {
+    ATOMIC_ORDER_RELAXED = 0,
+    ATOMIC_ORDER_ACQREL = 1,
+    ATOMIC_ORDER_SEQCST = 2
+} atomic_order_t;
+
+typedef enum {
+    ATOMIC_LOC_SHARED = 0,
+    ATOMIC_LOC_PRIVATE = 1
+} atomic_loc_t;
+
+/**
+ * How the signal worker's supervisor sends SIGUSR1, how workers consume it,
+ * and whether workers are signalled one at a time or all at once
+ */
+typedef enum {
+    SIGNAL_SEND_KILL = 0,
+    SIGNAL_SEND_TGKILL = 1,
+    SIGNAL_SEND_PTHREAD_KILL = 2
+} signal_send_t;
+
+typedef enum {
+    SIGNAL_RECV_HANDLER = 0,
+    SIGNAL_RECV_SIGWAITINFO = 1,
+    SIGNAL_RECV_SIGNALFD = 2
+} signal_recv_t;
+
+typedef enum {
+    SIGNAL_PATTERN_PING = 0,
+    SIGNAL_PATTERN_BROADCAST = 1
+} signal_pattern_t;
+
+/**
+ * Descriptor kind the fdchurn worker allocates and releases
+ */
+typedef enum {
+    FD_KIND_FILE = 0,
+    FD_KIND_PIPE = 1,
+    FD_KIND_EVENTFD = 2,
+    FD_KIND_MIX = 3
+} fd_kind_t;
+
+/**
+ * How the driver runs its workers (from its backend, see bench.h)
+ */
+typedef enum {
+    WORKER_MODEL_THREADS = 0,    // Threads of the driver process (progB, progO)
+    WORKER_MODEL_PROCESSES = 1,  // Single-threaded child processes (progA)
+    WORKER_MODEL_HYBRID = 2      // Threads of several child processes (progH)
+} worker_model_t;
+
+/**
+ * Work size of one worker, shared by the drivers and passed to every
+ * worker they start. WORK_PARAMS_DEFAULT reproduces the fixed counts above.
+ */
+typedef struct work_params {
+    int cpu_iterations;      // Outer Leibniz iterations (1,000,000 terms each)
+    size_t mem_bytes;        // mem worker array size
+    int mem_passes;          // Sweeps over the mem worker array
+    io_mode_t io_mode;       // I/O file strategy
+    int io_passes;           // 10MB write/read passes
+    int plugin_units;        // run_unit() calls for plugin workers (--units)
+    const char *worker_arg;  // Free-form plugin argument (--worker-arg)
+    const tkernel_t *kernel; // Templated cpu/mem kernel variant (--kernel), NULL = C kernels
+    int bsp_supersteps;      // bsp supersteps (--supersteps)
+    int bsp_slice;           // Leibniz terms per bsp compute slice (--bsp-slice)
+    barrier_kind_t barrier;  // bsp barrier implementation (--barrier)
+    struct bsp_shared *bsp;  // bsp barrier and result slots (bsp_setup()), NULL = solo
+    int imb_rounds;          // imbalance rounds over the task set (--rounds)
+    int imb_tasks;           // Tasks per round (--tasks)
+    int imb_task_cost;       // Mean task cost (--task-cost)
+    task_dist_t imb_dist;    // Task cost distribution (--dist)
+    task_kernel_t imb_kernel; // Task kernel (--task-kernel)
+    schedule_t imb_schedule; // Task distribution policy (--schedule)
+    int imb_chunk;           // dynamic chunk / guided minimum chunk (--schedule=P,C)
+    struct imbalance_shared *imbalance; // Task costs, counter, slots (imbalance_setup())
+    int atomic_batches;      // atomic batches (--batches)
+    int atomic_batch_ops;    // Atomic operations per batch (--batch-ops)
+    atomic_op_t atomic_op;   // Operation (--atomic-op)
+    atomic_order_t atomic_order; // Memory order (--order)
+    atomic_loc_t atomic_loc; // Shared or per-worker word (--location)
+    struct atomic_shared *atomic; // Locations and result slots (atomic_setup())
+    int sig_rounds;          // Signals per signal worker (--signals)
+    signal_send_t sig_send;  // Send call (--sig-send)
+    signal_recv_t sig_recv;  // Consumption (--sig-recv)
+    signal_pattern_t sig_pattern; // ping or broadcast (--sig-pattern)
+    struct signal_shared *signal; // Registration and ack words (signal_setup())
+    int fd_batches;          // fdchurn batches (--fd-batches)
+    int fd_batch;            // Cycles per fdchurn batch (--fd-batch)
+    fd_kind_t fd_kind;       // Descriptor kind (--fd-kind)
+    struct fdchurn_shared *fdchurn; // Result slots (fdchurn_setup())
+    int cow_batches;         // cow lookup batches (--cow-batches)
+    int cow_lookups;         // Lookups per cow batch (--cow-lookups)
+    size_t cow_bytes;        // cow dataset size (--dataset-mb)
+    double cow_write;        // Fraction of dataset pages each worker modifies (--cow-write)
+    struct cow_shared *cow;  // Dataset and result slots (cow_setup())
+    int idle_sleeps;         // idle worker sleeps (--idle-sleeps)
+    int idle_ms;             // Length of one idle sleep (--idle-ms)
+    worker_model_t model;    // Backend's worker model (set by the parser)
+} work_params_t;
+
+#define WORK_PARAMS_DEFAULT \
+    { CPU_MEM_LOOP_COUNT, MEM_ARRAY_BYTES, CPU_MEM_LOOP_COUNT, IO_MODE_TRUNCATE, IO_LOOP_COUNT, \
+      CPU_MEM_LOOP_COUNT, NULL, NULL, BSP_SUPERSTEPS, BSP_SLICE_TERMS, BARRIER_PTHREAD, NULL, \
+      IMB_ROUNDS, IMB_TASKS, IMB_TASK_COST, TASK_DIST_UNIFORM, TASK_KERNEL_CPU, SCHEDULE_STATIC, \
+      1, NULL, ATOMIC_BATCHES, ATOMIC_BATCH_OPS, ATOMIC_OP_ADD, ATOMIC_ORDER_SEQCST, \
+      ATOMIC_LOC_SHARED, NULL, SIGNAL_ROUNDS, SIGNAL_SEND_TGKILL, SIGNAL_RECV_HANDLER, \
+      SIGNAL_PATTERN_PING, NULL, FD_BATCHES, FD_BATCH_CYCLES, FD_KIND_MIX, NULL, COW_BATCHES, \
+      COW_BATCH_LOOKUPS, (size_t)COW_DATASET_MB << 20, 0.0, NULL, IDLE_SLEEPS, IDLE_SLEEP_MS, \
+      WORKER_MODEL_THREADS }
+
+/**
+ * Built-in workers as worker_ops_t tables (registered in registry.c).
+ * One unit is an outer cpu iteration, a mem write+read pass over
+ * work->mem_bytes, or a 10MB io write/fsync/read pass in work->io_mode.
+ */
+extern const worker_ops_t cpu_worker_ops;
+extern const worker_ops_t mem_worker_ops;
+extern const worker_ops_t io_worker_ops;
 
 #endif /* WORKERS_H */
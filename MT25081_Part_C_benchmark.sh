@@ -10,6 +10,11 @@ OUTPUT_CSV="MT25081_Part_C_CSV.csv"
 # Log directory for temporary files and debugging info
 LOG_DIR="logs"
 
+# SMAPS=1 adds --smaps and fills the PSS/USS columns. Off by default: the
+# smaps barrier holds every worker at its peak until all arrive, which
+# changes the time, CPU and memory figures of the baseline runs.
+SMAPS=${SMAPS:-0}
+
 # Detect number of CPU cores available on this system
 CPU_CORES=$(nproc)
 
@@ -22,11 +27,14 @@ NC='\033[0m' # No Color
 # Create necessary directories
 mkdir -p "$LOG_DIR"
 
+# Pressure Stall Information helpers (PSI columns for every result row)
+source "$PROJECT_DIR/MT25081_Part_C_psi.sh"
+
 # Checks for the presence of required command-line tools.
 # Exits with an error message if any critical tool is missing.
 check_commands() {
     echo -e "${YELLOW}Checking for required tools...${NC}"
-    local required_commands=("iostat" "top" "taskset" "pgrep" "bc" "nproc")
+    local required_commands=("iostat" "top" "taskset" "setsid" "pgrep" "bc" "nproc")
     local missing_commands=()
 
     for cmd in "${required_commands[@]}"; do
@@ -55,7 +63,9 @@ check_commands() {
 
 # Initializes the CSV file with the correct headers for the new data format.
 init_csv() {
-    echo "Program+Worker,CPU%,Memory(KB),IO,Time(s)" > "$OUTPUT_CSV"
+    # Pss(KB)/Uss(KB) come from the program's --smaps MEM_RESULT line (SMAPS=1):
+    # unlike the summed top RES, shared pages are not counted once per child.
+    echo "Program+Worker,CPU%,Memory(KB),IO,Time(s),$PSI_CSV_HEADER,Calibrated_Count,Pss(KB),Uss(KB)" > "$OUTPUT_CSV"
 }
 
 # Runs a single benchmark test for a given program, worker, and scale.
@@ -79,18 +89,51 @@ run_benchmark() {
     # This ensures a consistent environment for comparing process vs. thread efficiency.
     local cpu_list="0"
 
+    # When TARGET_SECONDS is set, a separate untimed run calibrates the work
+    # size so one worker runs for about that long (--calibrate-only). The
+    # measured run gets the count through --units, so the probe is not part
+    # of its time, CPU%, I/O or PSI; the count is recorded in the CSV.
+    local extra_args=()
+    if [[ "$SMAPS" == "1" ]]; then
+        extra_args+=("--smaps")
+    fi
+    local calibrated=fixed
+    if [[ -n "$TARGET_SECONDS" ]]; then
+        local calibrate_file="$LOG_DIR/calibrate_${program}_${worker}_$count.log"
+        taskset -c "$cpu_list" "$program_path" "$worker" 1 \
+            --target-seconds="$TARGET_SECONDS" --calibrate-only > "$calibrate_file" 2>&1 || true
+        calibrated=$(grep -o "CALIBRATION .* count=[0-9]*" "$calibrate_file" | sed 's/.*count=//')
+        if [[ -n "$calibrated" ]]; then
+            extra_args+=("--units=$calibrated")
+        else
+            echo -e "${YELLOW}  Calibration failed (see $calibrate_file); using the fixed work size${NC}"
+            calibrated=fixed
+        fi
+    fi
+
     # ====== PHASE 3: INITIALIZE MONITORING ======
     # Start background disk I/O monitoring with iostat, sampling every second.
     # The output is saved to a temporary file for later processing.
     iostat -dx 1 > "$LOG_DIR/io.tmp" &
     local io_pid=$!
 
+    # Start PSI capture: cumulative stall totals now, avg10 every PSI_INTERVAL.
+    local psi_start=$(psi_snapshot)
+    psi_sampler_start "$LOG_DIR/psi.tmp"
+
     # ====== PHASE 4: EXECUTE PROGRAM ======
     # Use /usr/bin/time to capture wall-clock execution time (%e).
     # Use taskset to pin the program to the specified CPU core(s).
     # Stderr is redirected to a temp file to capture the time output.
     local time_file="$LOG_DIR/time.tmp"
-    /usr/bin/time -f "%e" taskset -c "$cpu_list" "$program_path" "$worker" "$count" 2> "$time_file" &
+    # When TIMELINE_INTERVAL_MS is set, ./timeline records a per-worker
+    # resource timeline (CPU time, RSS, I/O bytes, context switches) for the run.
+    local timeline_cmd=()
+    if [[ -n "$TIMELINE_INTERVAL_MS" ]]; then
+        timeline_cmd=("$PROJECT_DIR/timeline" "$LOG_DIR/timeline_${program}_${worker}_$count.csv" "$TIMELINE_INTERVAL_MS")
+    fi
+    local out_file="$LOG_DIR/out_${program}_${worker}_$count.log"
+    /usr/bin/time -f "%e" "${timeline_cmd[@]}" taskset -c "$cpu_list" "$program_path" "$worker" "$count" "${extra_args[@]}" > "$out_file" 2> "$time_file" &
     local program_pid=$!
     echo "DEBUG: Started $program_path ($worker) with PID: $program_pid"
 
@@ -148,6 +191,10 @@ run_benchmark() {
     kill $io_pid 2>/dev/null || true
     wait $io_pid 2>/dev/null || true
 
+    # Stop PSI capture and build the PSI CSV fields for this run.
+    psi_sampler_stop
+    local psi_fields=$(psi_csv_fields "$psi_start" "$(psi_snapshot)" "$LOG_DIR/psi.tmp")
+
     # Calculate the average CPU usage across all samples.
     local avg_cpu=0.00
     if [[ $samples -gt 0 ]]; then
@@ -160,18 +207,24 @@ run_benchmark() {
     local total_io=$(grep -v "^Linux" "$LOG_DIR/io.tmp" | awk '/^(sd|nvme|xvd)/ {sum+=$9} END {print sum+0}')
 
     # Read the execution time from the temp file.
-    local exec_time=$(cat "$time_file")
+    local exec_time=$(tail -n 1 "$time_file")
+
+    # Proportional and unique memory of all processes at the workers' peak.
+    local mem_result=$(grep " MEM_RESULT " "$out_file" | tail -n 1)
+    local pss_total=$(echo "$mem_result" | grep -o "pss_total_kb=[0-9]*" | cut -d= -f2)
+    local uss_total=$(echo "$mem_result" | grep -o "uss_total_kb=[0-9]*" | cut -d= -f2)
 
     # ====== PHASE 6: PRINT AND SAVE RESULTS ======
     echo -e "${GREEN}Completed: $label+$worker${NC}"
     echo "  Avg CPU: ${avg_cpu}%"
-    echo "  Max Memory: ${mem_max} KB"
+    echo "  Max Memory: ${mem_max} KB (PSS ${pss_total} KB, USS ${uss_total} KB)"
     echo "  Total I/O Writes: ${total_io} KB"
     echo "  Execution Time: ${exec_time}s"
+    echo "  PSI (cpu/mem/io some avg10, stall us): $psi_fields"
     echo ""
 
     # Append the results to the CSV file in the new, correct format.
-    echo "$label+$worker,$avg_cpu,$mem_max,$total_io,$exec_time" >> "$OUTPUT_CSV"
+    echo "$label+$worker,$avg_cpu,$mem_max,$total_io,$exec_time,$psi_fields,$calibrated,$pss_total,$uss_total" >> "$OUTPUT_CSV"
 
     # ====== DIAGNOSTIC: PRINT IO.TMP FOR IO WORKER ======
     # If the worker is 'io', print the raw iostat log to the console for debugging.
@@ -223,15 +276,30 @@ main() {
     
     # Define programs and workers to be tested.
     local programs=("progA" "progB")
+    # The OpenMP driver is optional; only the base build exists.
+    if [[ -f "$PROJECT_DIR/progO" ]]; then
+        programs+=("progO")
+    fi
     local workers=("cpu" "mem" "io")
 
-    # Run all 6 benchmark combinations.
-    echo -e "${YELLOW}Running 6 baseline benchmark combinations...${NC}"
+    # Run all program/worker combinations (6, or 9 with progO).
+    echo -e "${YELLOW}Running ${#programs[@]}x${#workers[@]} baseline benchmark combinations per build variant...${NC}"
     echo "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━"
     
-    for prog in "${programs[@]}"; do
-        for worker in "${workers[@]}"; do
-            run_benchmark "$prog" "$worker" 2 "$prog" || echo "$prog $worker failed"
+    # Build variants to sweep (see 'make variants'), e.g. "base native lto pgo".
+    # Non-base variants run the suffixed binaries and are labelled progA.lto etc.
+    local variants=(${BINARY_VARIANTS:-base})
+
+    for variant in "${variants[@]}"; do
+        for prog in "${programs[@]}"; do
+            local binary=$prog
+            if [[ "$variant" != "base" ]]; then
+                binary="$prog.$variant"
+                [[ -f "$PROJECT_DIR/$binary" ]] || continue
+            fi
+            for worker in "${workers[@]}"; do
+                run_benchmark "$binary" "$worker" 2 "$binary" || echo "$binary $worker failed"
+            done
         done
     done
     
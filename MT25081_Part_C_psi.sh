@@ -0,0 +1,101 @@
+# Pressure Stall Information (PSI) helpers, sourced by the Part C and Part D
+# benchmark scripts.
+#
+# Each run gets PSI for cpu, memory and io:
+#   - cumulative "total=" stall microseconds, sampled at start and end
+#     (the delta is the stall time caused while the run was active)
+#   - "avg10" percentages, sampled continuously every PSI_INTERVAL seconds
+#     by a background sampler and averaged over the run
+#
+# By default the system-wide /proc/pressure files are read. Set PSI_CGROUP to
+# a cgroup v2 directory (e.g. /sys/fs/cgroup/bench.slice) to read that
+# cgroup's cpu.pressure, memory.pressure and io.pressure instead.
+
+# Sampling interval (seconds) for the continuous avg10 sampler.
+PSI_INTERVAL=${PSI_INTERVAL:-0.5}
+
+# Resources captured for every run, in CSV column order.
+PSI_RESOURCES=("cpu" "memory" "io")
+
+# CSV header fragment for the PSI columns appended to each result row.
+PSI_CSV_HEADER="PSI_CPU_SomeAvg10,PSI_CPU_FullAvg10,PSI_CPU_Some_us,PSI_CPU_Full_us,PSI_Mem_SomeAvg10,PSI_Mem_FullAvg10,PSI_Mem_Some_us,PSI_Mem_Full_us,PSI_IO_SomeAvg10,PSI_IO_FullAvg10,PSI_IO_Some_us,PSI_IO_Full_us"
+
+# Prints the PSI file path for a resource (cgroup file if PSI_CGROUP is set).
+psi_file() {
+    local res=$1
+    if [[ -n "$PSI_CGROUP" ]]; then
+        echo "$PSI_CGROUP/$res.pressure"
+    else
+        echo "/proc/pressure/$res"
+    fi
+}
+
+# Prints "some_total full_total" in microseconds for a resource (0 0 if absent).
+psi_totals() {
+    local file
+    file=$(psi_file "$1")
+    if [[ ! -r "$file" ]]; then
+        echo "0 0"
+        return
+    fi
+    awk '{ for (i = 2; i <= NF; i++) if ($i ~ /^total=/) t[$1] = substr($i, 7) }
+         END { print t["some"] + 0, t["full"] + 0 }' "$file"
+}
+
+# Prints the start/end snapshot: "cpu_some cpu_full mem_some mem_full io_some io_full".
+psi_snapshot() {
+    local res out=""
+    for res in "${PSI_RESOURCES[@]}"; do
+        out="$out $(psi_totals "$res")"
+    done
+    echo $out
+}
+
+# Starts the background avg10 sampler writing "res some_avg10 full_avg10" lines
+# to the given log file. Sets PSI_SAMPLER_PID. The sampler runs in its own
+# session (setsid), so its awk/sleep children are not in the benchmark's
+# process group and the scripts' pgrep -g does not add them to AvgCPU.
+psi_sampler_start() {
+    local log=$1
+    local res targets=()
+    for res in "${PSI_RESOURCES[@]}"; do
+        targets+=("$res=$(psi_file "$res")")
+    done
+    : > "$log"
+    setsid bash -c '
+        interval=$1
+        shift
+        while true; do
+            for target in "$@"; do
+                file=${target#*=}
+                [[ -r "$file" ]] || continue
+                awk -v r="${target%%=*}" '"'"'{ split($2, a, "="); v[$1] = a[2] }
+                     END { print r, v["some"] + 0, v["full"] + 0 }'"'"' "$file"
+            done
+            sleep "$interval"
+        done' psi_sampler "$PSI_INTERVAL" "${targets[@]}" >> "$log" &
+    PSI_SAMPLER_PID=$!
+}
+
+# Stops the background sampler started by psi_sampler_start.
+psi_sampler_stop() {
+    kill "$PSI_SAMPLER_PID" 2>/dev/null || true
+    wait "$PSI_SAMPLER_PID" 2>/dev/null || true
+}
+
+# Prints the 12 PSI CSV fields (see PSI_CSV_HEADER) for one run, given the
+# start snapshot, end snapshot and sampler log.
+psi_csv_fields() {
+    local start=$1
+    local end=$2
+    local log=$3
+    local -a s=($start) e=($end)
+    local fields="" idx=0 res avgs
+    for res in "${PSI_RESOURCES[@]}"; do
+        avgs=$(awk -v r="$res" '$1 == r { some += $2; full += $3; n++ }
+                    END { if (n) printf "%.2f,%.2f", some / n, full / n; else print "0.00,0.00" }' "$log")
+        fields="$fields,$avgs,$(( e[idx] - s[idx] )),$(( e[idx + 1] - s[idx + 1] ))"
+        idx=$((idx + 2))
+    done
+    echo "${fields#,}"
+}
@@ -0,0 +1,388 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "MT25081_Part_B_timing.h"
+
+/**
+ * PURPOSE:
+ *   Startup latency benchmark for the benchmark drivers. Launches a command
+ *   (progA, progB, progA.static, ...) many times and measures, per launch:
+ *   exec to main(), exec to the first worker's start and exec to exit. A
+ *   second, shorter series runs with LD_DEBUG=statistics and reports the
+ *   time the dynamic loader spent before main() (relocation, loading).
+ *
+ * USAGE:
+ *   ./startup <output.csv> <launches> <command> [args...]
+ *
+ *   Parameters:
+ *   - output.csv: Per-launch file to write (one row per launch)
+ *   - launches:   Timed launches (1-1000000; thousands for stable tails)
+ *   - command:    A benchmark driver, possibly behind a wrapper such as
+ *                 taskset. "--startup" is appended to its arguments
+ *
+ * EXAMPLES:
+ *   ./startup logs/startup_progA.csv 2000 ./progA idle 1 --idle-ms=0
+ *   ./startup logs/startup_progB_static.csv 2000 ./progB.static idle 1 --idle-ms=0 --quiet
+ *
+ * CSV COLUMNS:
+ *   launch                  - 1..launches, then the LD_DEBUG launches
+ *   ld_debug                - 1 if the launch ran with LD_DEBUG=statistics
+ *   exec_to_main_us         - execvp() call until bench_main() is entered
+ *   exec_to_first_worker_us - execvp() call until the first worker starts
+ *   timer_init_us           - Of which the driver's timing_init() (its
+ *                             STARTUP line), a fixed calibration spin
+ *   exec_to_first_worker_net_us - exec_to_first_worker_us - timer_init_us
+ *   exec_to_exit_us         - execvp() call until waitpid() returns
+ *   ld_total_us             - Dynamic loader time before main (ld_debug rows)
+ *   ld_reloc_us             - Of which relocation
+ *   ld_load_us              - Of which loading objects
+ *   relocations             - Symbol relocations processed at startup
+ *   relative_relocations    - Relative relocations processed at startup
+ *   exit_status             - The command's exit status
+ *
+ * OUTPUT:
+ *   One "[startup] STARTUP_RESULT ..." line with p50/p99/mean of the three
+ *   latencies and of exec_to_first_worker_net_us, the p50 of timer_init_us
+ *   and the mean loader breakdown.
+ *
+ * NOTES:
+ *   - All timestamps are CLOCK_MONOTONIC, shared by every process. The
+ *     exec timestamp is taken in the forked child immediately before
+ *     execvp() and handed back through a MAP_SHARED page; the driver prints
+ *     its main and first-worker timestamps on its STARTUP line.
+ *   - --startup makes the driver calibrate its timer over 1 ms instead of
+ *     20 ms; the rest is still reported, and subtracted in the _net column,
+ *     so the static/dynamic and --quiet differences are not hidden by it.
+ *   - The loader reports cycles (rdtsc); they are converted with the
+ *     calibrated TSC period. A static driver has no loader: its ld columns
+ *     stay empty.
+ *   - The LD_DEBUG series is separate because writing the statistics costs
+ *     time itself: min(launches, LD_LAUNCHES) launches, excluded from the
+ *     timed percentiles.
+ * ============================================================================
+ */
+
+#define LD_LAUNCHES 100   // Upper bound on the LD_DEBUG=statistics launches
+
+/**
+ * Measurements of one launch (ld_* < 0: not measured)
+ */
+typedef struct {
+    double exec_to_main_us;
+    double exec_to_first_worker_us;
+    double timer_init_us;
+    double exec_to_first_worker_net_us;
+    double exec_to_exit_us;
+    double ld_total_us;
+    double ld_reloc_us;
+    double ld_load_us;
+    long relocations;
+    long relative_relocations;
+    int status;
+} launch_t;
+
+/**
+ * field_u64() - Value of "key=" in a line, 0 if absent
+ */
+static unsigned long long field_u64(const char *line, const char *key) {
+    const char *p = strstr(line, key);
+    return p != NULL ? strtoull(p + strlen(key), NULL, 10) : 0;
+}
+
+/**
+ * field_double() - Value of "key=" in a line, 0.0 if absent
+ */
+static double field_double(const char *line, const char *key) {
+    const char *p = strstr(line, key);
+    return p != NULL ? strtod(p + strlen(key), NULL) : 0.0;
+}
+
+/**
+ * ld_stat() - Number after "label:" in a LD_DEBUG statistics line, -1 if the
+ * line does not carry that label
+ */
+static long long ld_stat(const char *line, const char *label) {
+    const char *p = strstr(line, label);
+    return p != NULL ? strtoll(p + strlen(label), NULL, 10) : -1;
+}
+
+/**
+ * read_ld_stats() - Parses the startup block of an LD_DEBUG_OUTPUT file
+ *
+ * The block is printed once before main(); a second, "final" block at exit
+ * only repeats the relocation counts and is ignored.
+ */
+static void read_ld_stats(const char *path, launch_t *l) {
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return;   // Static binary: no loader, no file
+    }
+    char line[256];
+    long long v;
+    double ns_per_cycle = timing_use_counter ? timing_ns_per_tick : -1.0;
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if ((v = ld_stat(line, "total startup time in dynamic loader:")) >= 0) {
+            l->ld_total_us = v * ns_per_cycle / 1e3;
+        } else if ((v = ld_stat(line, "time needed for relocation:")) >= 0) {
+            l->ld_reloc_us = v * ns_per_cycle / 1e3;
+        } else if ((v = ld_stat(line, "time needed to load objects:")) >= 0) {
+            l->ld_load_us = v * ns_per_cycle / 1e3;
+        } else if (strstr(line, "final number of") != NULL) {
+            break;
+        } else if ((v = ld_stat(line, "number of relative relocations:")) >= 0) {
+            l->relative_relocations = (long)v;
+        } else if ((v = ld_stat(line, "number of relocations:")) >= 0) {
+            l->relocations = (long)v;
+        }
+    }
+    fclose(fp);
+}
+
+/**
+ * launch() - Runs the command once and fills *l; returns -1 if the driver
+ * printed no STARTUP line
+ *
+ * ld_prefix != NULL runs it with LD_DEBUG=statistics, writing to
+ * ld_prefix.<pid>, which is parsed and removed.
+ */
+static int launch(char **cmd, volatile uint64_t *exec_ns, const char *ld_prefix, launch_t *l) {
+    int out[2];
+    if (pipe(out) != 0) {
+        perror("pipe");
+        exit(EXIT_FAILURE);
+    }
+
+    pid_t child = fork();
+    if (child < 0) {
+        perror("fork");
+        exit(EXIT_FAILURE);
+    } else if (child == 0) {
+        dup2(out[1], STDOUT_FILENO);
+        close(out[0]);
+        close(out[1]);
+        if (ld_prefix != NULL) {
+            setenv("LD_DEBUG", "statistics", 1);
+            setenv("LD_DEBUG_OUTPUT", ld_prefix, 1);
+        }
+        *exec_ns = timing_monotonic_ns();
+        execvp(cmd[0], cmd);
+        perror("execvp");
+        _exit(127);
+    }
+    close(out[1]);
+
+    // The driver's output; only its STARTUP line is kept
+    unsigned long long main_ns = 0, first_ns = 0;
+    double timer_us = 0.0;
+    FILE *fp = fdopen(out[0], "r");
+    char *line = NULL;
+    size_t cap = 0;
+    while (getline(&line, &cap, fp) > 0) {
+        if (strstr(line, " STARTUP main_ns=") != NULL) {
+            main_ns = field_u64(line, "main_ns=");
+            first_ns = field_u64(line, "first_worker_ns=");
+            timer_us = field_double(line, "timer_init_us=");
+        }
+    }
+    free(line);
+    fclose(fp);
+
+    int status;
+    waitpid(child, &status, 0);
+    uint64_t exit_ns = timing_monotonic_ns();
+    uint64_t t0 = *exec_ns;
+
+    memset(l, 0, sizeof(*l));
+    l->ld_total_us = l->ld_reloc_us = l->ld_load_us = -1.0;
+    l->relocations = l->relative_relocations = -1;
+    l->status = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+    l->exec_to_exit_us = (exit_ns - t0) / 1e3;
+    if (ld_prefix != NULL) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s.%d", ld_prefix, (int)child);
+        read_ld_stats(path, l);
+        unlink(path);
+    }
+    if (main_ns < t0 || first_ns < main_ns) {
+        return -1;
+    }
+    l->exec_to_main_us = (main_ns - t0) / 1e3;
+    l->exec_to_first_worker_us = (first_ns - t0) / 1e3;
+    l->timer_init_us = timer_us;
+    l->exec_to_first_worker_net_us = l->exec_to_first_worker_us - timer_us;
+    return 0;
+}
+
+/**
+ * write_row() - One CSV row; unmeasured loader columns are left empty
+ */
+static void write_row(FILE *out, int index, int ld_debug, const launch_t *l) {
+    fprintf(out, "%d,%d,%.1f,%.1f,%.1f,%.1f,%.1f,", index, ld_debug, l->exec_to_main_us,
+            l->exec_to_first_worker_us, l->timer_init_us, l->exec_to_first_worker_net_us,
+            l->exec_to_exit_us);
+    if (l->ld_total_us >= 0.0) {
+        fprintf(out, "%.1f,%.1f,%.1f,%ld,%ld,", l->ld_total_us, l->ld_reloc_us, l->ld_load_us,
+                l->relocations, l->relative_relocations);
+    } else {
+        fprintf(out, ",,,,,");
+    }
+    fprintf(out, "%d\n", l->status);
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * summarize() - Sorts v[0..n-1] and returns its p50, p99 and mean
+ */
+static void summarize(double *v, int n, double *p50, double *p99, double *mean) {
+    *p50 = *p99 = *mean = 0.0;
+    if (n == 0) {
+        return;
+    }
+    qsort(v, n, sizeof(double), cmp_double);
+    double sum = 0.0;
+    for (int i = 0; i < n; i++) {
+        sum += v[i];
+    }
+    *p50 = v[n / 2];
+    *p99 = v[(int)(0.99 * (n - 1))];
+    *mean = sum / n;
+}
+
+/**
+ * main() - Entry point for the startup latency benchmark
+ *
+ * WHAT IT DOES:
+ *   1. Calibrates the TSC (for the loader's cycle counts)
+ *   2. Launches the command <launches> times, recording each launch
+ *   3. Launches it up to LD_LAUNCHES more times with LD_DEBUG=statistics
+ *   4. Prints the STARTUP_RESULT summary
+ */
+int main(int argc, char *argv[]) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s <output.csv> <launches> <command> [args...]\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    int launches = atoi(argv[2]);
+    if (launches < 1 || launches > 1000000) {
+        fprintf(stderr, "Error: launches must be between 1 and 1000000\n");
+        exit(EXIT_FAILURE);
+    }
+
+    FILE *out = fopen(argv[1], "w");
+    if (out == NULL) {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    fprintf(out, "launch,ld_debug,exec_to_main_us,exec_to_first_worker_us,timer_init_us,"
+                 "exec_to_first_worker_net_us,exec_to_exit_us,"
+                 "ld_total_us,ld_reloc_us,ld_load_us,relocations,relative_relocations,"
+                 "exit_status\n");
+
+    // The command with "--startup" appended, NULL-terminated for execvp()
+    int cmd_len = argc - 3;
+    char **cmd = calloc(cmd_len + 2, sizeof(char *));
+    double *main_us = malloc(launches * sizeof(double));
+    double *first_us = malloc(launches * sizeof(double));
+    double *timer_us = malloc(launches * sizeof(double));
+    double *net_us = malloc(launches * sizeof(double));
+    double *exit_us = malloc(launches * sizeof(double));
+    if (cmd == NULL || main_us == NULL || first_us == NULL || timer_us == NULL ||
+        net_us == NULL || exit_us == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(cmd, &argv[3], cmd_len * sizeof(char *));
+    cmd[cmd_len] = "--startup";
+
+    // Written by each child right before execvp(), read after waitpid()
+    volatile uint64_t *exec_ns = mmap(NULL, sizeof(uint64_t), PROT_READ | PROT_WRITE,
+                                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (exec_ns == MAP_FAILED) {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+
+    timing_init();
+
+    // TIMED SERIES: no LD_DEBUG; failed launches are written but not summarized
+    int ok = 0, failed = 0;
+    launch_t l;
+    for (int i = 0; i < launches; i++) {
+        int rc = launch(cmd, exec_ns, NULL, &l);
+        write_row(out, i + 1, 0, &l);
+        if (rc != 0 || l.status != 0) {
+            failed++;
+            continue;
+        }
+        main_us[ok] = l.exec_to_main_us;
+        first_us[ok] = l.exec_to_first_worker_us;
+        timer_us[ok] = l.timer_init_us;
+        net_us[ok] = l.exec_to_first_worker_net_us;
+        exit_us[ok] = l.exec_to_exit_us;
+        ok++;
+    }
+
+    // LOADER SERIES: LD_DEBUG=statistics to a per-pid file in /tmp
+    char ld_prefix[64];
+    snprintf(ld_prefix, sizeof(ld_prefix), "/tmp/pa01_startup_ld_%d", (int)getpid());
+    int ld_launches = launches < LD_LAUNCHES ? launches : LD_LAUNCHES;
+    int ld_ok = 0;
+    double ld_total = 0.0, ld_reloc = 0.0, ld_load = 0.0;
+    long relocations = 0, relative = 0;
+    for (int i = 0; i < ld_launches; i++) {
+        launch(cmd, exec_ns, ld_prefix, &l);
+        write_row(out, launches + i + 1, 1, &l);
+        if (l.ld_total_us >= 0.0) {
+            ld_total += l.ld_total_us;
+            ld_reloc += l.ld_reloc_us;
+            ld_load += l.ld_load_us;
+            relocations = l.relocations;
+            relative = l.relative_relocations;
+            ld_ok++;
+        }
+    }
+    fclose(out);
+
+    double main_p50, main_p99, main_mean, first_p50, first_p99, first_mean;
+    double timer_p50, timer_p99, timer_mean, net_p50, net_p99, net_mean;
+    double exit_p50, exit_p99, exit_mean;
+    summarize(main_us, ok, &main_p50, &main_p99, &main_mean);
+    summarize(first_us, ok, &first_p50, &first_p99, &first_mean);
+    summarize(timer_us, ok, &timer_p50, &timer_p99, &timer_mean);
+    summarize(net_us, ok, &net_p50, &net_p99, &net_mean);
+    summarize(exit_us, ok, &exit_p50, &exit_p99, &exit_mean);
+    printf("[startup] STARTUP_RESULT command=%s launches=%d failed=%d "
+           "exec_to_main_us_p50=%.1f exec_to_main_us_p99=%.1f exec_to_main_us_mean=%.1f "
+           "exec_to_first_worker_us_p50=%.1f exec_to_first_worker_us_p99=%.1f "
+           "exec_to_first_worker_us_mean=%.1f timer_init_us_p50=%.1f "
+           "exec_to_first_worker_net_us_p50=%.1f exec_to_first_worker_net_us_p99=%.1f "
+           "exec_to_first_worker_net_us_mean=%.1f exec_to_exit_us_p50=%.1f "
+           "exec_to_exit_us_p99=%.1f exec_to_exit_us_mean=%.1f ld_launches=%d "
+           "ld_total_us=%.1f ld_reloc_us=%.1f ld_load_us=%.1f relocations=%ld "
+           "relative_relocations=%ld\n",
+           argv[3], launches, failed, main_p50, main_p99, main_mean, first_p50, first_p99,
+           first_mean, timer_p50, net_p50, net_p99, net_mean, exit_p50, exit_p99, exit_mean,
+           ld_ok,
+           ld_ok ? ld_total / ld_ok : 0.0, ld_ok ? ld_reloc / ld_ok : 0.0,
+           ld_ok ? ld_load / ld_ok : 0.0, ld_ok ? relocations : 0L, ld_ok ? relative : 0L);
+
+    free(cmd);
+    free(main_us);
+    free(first_us);
+    free(timer_us);
+    free(net_us);
+    free(exit_us);
+    munmap((void *)exec_ns, sizeof(uint64_t));
+    return failed == launches ? EXIT_FAILURE : EXIT_SUCCESS;
+}
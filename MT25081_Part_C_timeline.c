@@ -0,0 +1,332 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+/**
+ * PURPOSE:
+ *   High-resolution resource timeline recorder for a single benchmark run.
+ *   Launches a command (e.g. progA/progB), then every INTERVAL milliseconds
+ *   samples every task (thread) of the command and all its descendant
+ *   processes, and appends one CSV row per task to the output file.
+ *
+ * USAGE:
+ *   ./timeline <output.csv> <interval_ms> <command> [args...]
+ *
+ *   Parameters:
+ *   - output.csv: Timeline file to write (one row per task per sample)
+ *   - interval_ms: Sampling interval in milliseconds (1-1000, 10-100 typical)
+ *   - command: Program to run; its exit status is returned unchanged
+ *
+ * EXAMPLES:
+ *   ./timeline logs/timeline_progA_mem_2.csv 20 ./progA mem 2
+ *   ./timeline logs/timeline_progB_io_4.csv 50 taskset -c 0 ./progB io 4
+ *
+ * CSV COLUMNS:
+ *   t_ms        - Milliseconds since the command was started
+ *   pid, tid    - Process and thread ID (a progA worker is a pid,
+ *                 a progB worker is a tid inside one pid)
+ *   utime_ms    - User CPU time of the task (cumulative)
+ *   stime_ms    - System CPU time of the task (cumulative)
+ *   rss_kb      - Resident set size of the owning process
+ *   rchar       - Bytes read through read()-like syscalls (cumulative)
+ *   wchar       - Bytes written through write()-like syscalls (cumulative)
+ *   read_bytes  - Bytes fetched from storage (cumulative)
+ *   write_bytes - Bytes sent to storage (cumulative)
+ *   vol_ctx     - Voluntary context switches (cumulative)
+ *   invol_ctx   - Involuntary context switches (cumulative)
+ *
+ *   Cumulative counters are differentiated by generate_timeline_plots.py.
+ *
+ * NOTES:
+ *   - The command stays in the caller's process group, so the top/pgrep
+ *     based monitoring in the Part C/D scripts keeps working. The recorder
+ *     moves itself into its own group so its sampling CPU is not counted.
+ *   - Only the command's own descendants are sampled (found through the
+ *     ppid chain on every tick), so short-lived children are picked up.
+ * ============================================================================
+ */
+
+#define MAX_TRACKED 4096   // Upper bound on processes tracked per sample
+
+static long clock_ticks;   // sysconf(_SC_CLK_TCK), for utime/stime conversion
+static long page_kb;       // Page size in kB, for statm conversion
+
+/**
+ * read_stat() - Reads ppid, utime and stime from a /proc/.../stat file
+ *
+ * The comm field may contain spaces and parentheses, so parsing starts
+ * after the last ')'.
+ */
+static int read_stat(const char *path, int *ppid, unsigned long *utime, unsigned long *stime) {
+    char buf[1024];
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return -1;
+    }
+    size_t n = fread(buf, 1, sizeof(buf) - 1, fp);
+    fclose(fp);
+    buf[n] = '\0';
+
+    char *p = strrchr(buf, ')');
+    if (p == NULL) {
+        return -1;
+    }
+
+    // Fields after comm: state(3) ppid(4) ... utime(14) stime(15)
+    char state;
+    int parent;
+    unsigned long ut, st;
+    if (sscanf(p + 2, "%c %d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu",
+               &state, &parent, &ut, &st) != 4) {
+        return -1;
+    }
+    if (ppid) *ppid = parent;
+    if (utime) *utime = ut;
+    if (stime) *stime = st;
+    return 0;
+}
+
+/**
+ * read_io() - Reads the four byte counters from a /proc/.../io file
+ */
+static void read_io(const char *path, unsigned long long out[4]) {
+    const char *keys[4] = {"rchar:", "wchar:", "read_bytes:", "write_bytes:"};
+    memset(out, 0, 4 * sizeof(out[0]));
+
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return;
+    }
+    char line[128];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        for (int k = 0; k < 4; k++) {
+            size_t len = strlen(keys[k]);
+            if (strncmp(line, keys[k], len) == 0) {
+                out[k] = strtoull(line + len, NULL, 10);
+            }
+        }
+    }
+    fclose(fp);
+}
+
+/**
+ * read_ctx() - Reads voluntary/involuntary context switches from status
+ */
+static void read_ctx(const char *path, unsigned long *vol, unsigned long *invol) {
+    *vol = *invol = 0;
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return;
+    }
+    char line[128];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (strncmp(line, "voluntary_ctxt_switches:", 24) == 0) {
+            *vol = strtoul(line + 24, NULL, 10);
+        } else if (strncmp(line, "nonvoluntary_ctxt_switches:", 27) == 0) {
+            *invol = strtoul(line + 27, NULL, 10);
+        }
+    }
+    fclose(fp);
+}
+
+/**
+ * read_rss_kb() - Reads the resident set size of a process from statm
+ */
+static long read_rss_kb(int pid) {
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/%d/statm", pid);
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return 0;
+    }
+    long size = 0, resident = 0;
+    if (fscanf(fp, "%ld %ld", &size, &resident) != 2) {
+        resident = 0;
+    }
+    fclose(fp);
+    return resident * page_kb;
+}
+
+/**
+ * collect_descendants() - Fills pids[] with root and all its descendants
+ *
+ * Scans /proc once and then repeatedly adopts any process whose parent is
+ * already in the set, so grandchildren (e.g. taskset -> progA -> child)
+ * are found regardless of /proc ordering.
+ */
+static int collect_descendants(int root, int *pids) {
+    static int all_pid[MAX_TRACKED * 4];
+    static int all_ppid[MAX_TRACKED * 4];
+    int total = 0;
+
+    DIR *dir = opendir("/proc");
+    if (dir == NULL) {
+        return 0;
+    }
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL && total < MAX_TRACKED * 4) {
+        int pid = atoi(ent->d_name);
+        if (pid <= 0) {
+            continue;
+        }
+        char path[64];
+        int ppid;
+        snprintf(path, sizeof(path), "/proc/%d/stat", pid);
+        if (read_stat(path, &ppid, NULL, NULL) == 0) {
+            all_pid[total] = pid;
+            all_ppid[total] = ppid;
+            total++;
+        }
+    }
+    closedir(dir);
+
+    int count = 0;
+    pids[count++] = root;
+    int added = 1;
+    while (added && count < MAX_TRACKED) {
+        added = 0;
+        for (int i = 0; i < total && count < MAX_TRACKED; i++) {
+            int parent_known = 0, already = 0;
+            for (int j = 0; j < count; j++) {
+                if (pids[j] == all_ppid[i]) parent_known = 1;
+                if (pids[j] == all_pid[i]) already = 1;
+            }
+            if (parent_known && !already) {
+                pids[count++] = all_pid[i];
+                added = 1;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * sample_process() - Writes one CSV row per thread of a process
+ */
+static void sample_process(FILE *out, long t_ms, int pid) {
+    char path[128];
+    snprintf(path, sizeof(path), "/proc/%d/task", pid);
+    DIR *dir = opendir(path);
+    if (dir == NULL) {
+        return;  // Process exited between discovery and sampling
+    }
+
+    long rss_kb = read_rss_kb(pid);
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL) {
+        int tid = atoi(ent->d_name);
+        if (tid <= 0) {
+            continue;
+        }
+        unsigned long utime = 0, stime = 0, vol, invol;
+        unsigned long long io[4];
+
+        snprintf(path, sizeof(path), "/proc/%d/task/%d/stat", pid, tid);
+        if (read_stat(path, NULL, &utime, &stime) != 0) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "/proc/%d/task/%d/io", pid, tid);
+        read_io(path, io);
+        snprintf(path, sizeof(path), "/proc/%d/task/%d/status", pid, tid);
+        read_ctx(path, &vol, &invol);
+
+        fprintf(out, "%ld,%d,%d,%lu,%lu,%ld,%llu,%llu,%llu,%llu,%lu,%lu\n",
+                t_ms, pid, tid,
+                utime * 1000 / clock_ticks, stime * 1000 / clock_ticks,
+                rss_kb, io[0], io[1], io[2], io[3], vol, invol);
+    }
+    closedir(dir);
+}
+
+/**
+ * main() - Entry point for the timeline recorder
+ *
+ * WHAT IT DOES:
+ *   1. Forks and execs the command
+ *   2. Every interval: finds the command's descendants and samples them
+ *   3. Stops when the command exits and returns its exit status
+ */
+int main(int argc, char *argv[]) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s <output.csv> <interval_ms> <command> [args...]\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    int interval_ms = atoi(argv[2]);
+    if (interval_ms < 1 || interval_ms > 1000) {
+        fprintf(stderr, "Error: interval_ms must be between 1 and 1000\n");
+        exit(EXIT_FAILURE);
+    }
+
+    FILE *out = fopen(argv[1], "w");
+    if (out == NULL) {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    fprintf(out, "t_ms,pid,tid,utime_ms,stime_ms,rss_kb,rchar,wchar,read_bytes,write_bytes,vol_ctx,invol_ctx\n");
+
+    clock_ticks = sysconf(_SC_CLK_TCK);
+    page_kb = sysconf(_SC_PAGESIZE) / 1024;
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pid_t child = fork();
+    if (child < 0) {
+        perror("fork");
+        exit(EXIT_FAILURE);
+    } else if (child == 0) {
+        execvp(argv[3], &argv[3]);
+        perror("execvp");
+        _exit(127);
+    }
+
+    // Leave the run's process group (see NOTES); the child stays in it
+    setpgid(0, 0);
+
+    // SAMPLING LOOP: absolute deadlines so sampling cost does not add drift
+    static int pids[MAX_TRACKED];
+    struct timespec next = start;
+    int status = 0;
+    for (;;) {
+        pid_t done = waitpid(child, &status, WNOHANG);
+        if (done == child) {
+            break;
+        }
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long t_ms = (now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000;
+
+        int count = collect_descendants(child, pids);
+        for (int i = 0; i < count; i++) {
+            sample_process(out, t_ms, pids[i]);
+        }
+
+        next.tv_nsec += (long)interval_ms * 1000000;
+        while (next.tv_nsec >= 1000000000) {
+            next.tv_nsec -= 1000000000;
+            next.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+    }
+
+    fclose(out);
+
+    // Propagate the command's exit status to the caller (e.g. /usr/bin/time)
+    if (WIFEXITED(status)) {
+        return WEXITSTATUS(status);
+    }
+    if (WIFSIGNALED(status)) {
+        signal(WTERMSIG(status), SIG_DFL);
+        raise(WTERMSIG(status));
+    }
+    return EXIT_FAILURE;
+}
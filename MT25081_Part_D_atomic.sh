@@ -0,0 +1,69 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for atomic memory-ordering results
+OUTPUT_CSV="MT25081_Part_D_atomic_CSV.csv"
+CSV_COLUMNS="Program,Op,Order,Location,Workers,CPUs,Ops,NsPerOp,Mops,CasFail_Pct,LostUpdates,ExitStatus"
+RESULT_LINE="ATOMIC_RESULT"
+
+# Operations, memory orders, locations and worker counts to sweep.
+OPS=(${OPS:-load store add cas})
+ORDERS=(${ORDERS:-relaxed acqrel seqcst})
+LOCATIONS=(${LOCATIONS:-shared private})
+SCALES=(${SCALES:-1 2 4 8 16})
+
+# Batches per run and atomic operations per batch.
+BATCHES=${BATCHES:-200}
+BATCH_OPS=${BATCH_OPS:-100000}
+
+# CPUs the runs may use (default: all; set e.g. CPU_LIST=0 to oversubscribe).
+CPU_LIST=${CPU_LIST:-0-$(($(nproc) - 1))}
+
+# Runs one operation/order/location/worker-count configuration and appends a CSV row.
+run_atomic_benchmark() {
+    local program=$1
+    local op=$2
+    local order=$3
+    local location=$4
+    local scale=$5
+    local log="$LOG_DIR/atomic_${program}_${op}_${order}_${location}_${scale}.log"
+
+    echo -e "${CYAN}  Running: $program atomic scale=$scale op=$op order=$order location=$location${NC}"
+
+    run_logged "$log" "$PROJECT_DIR/$program" atomic "$scale" --atomic-op="$op" --order="$order" \
+        --location="$location" --batches="$BATCHES" --batch-ops="$BATCH_OPS"
+
+    local fields
+    fields=$(result_fields "$log" cpus ops ns_per_op mops cas_fail_pct lost_updates)
+    append_row "$program,$op,$order,$location,$scale$fields,$RUN_STATUS"
+}
+
+main() {
+    print_banner "ATOMIC MEMORY ORDERING - PROCESSES VS THREADS" \
+        "Measure ns/op of atomic load/store/add/cas per memory" \
+        "order on shared and private words vs worker count."
+    require_programs progA progB
+
+    echo -e "${YELLOW}CPUs: $CPU_LIST, batches: $BATCHES x $BATCH_OPS ops${NC}"
+    init_csv
+
+    for op in "${OPS[@]}"; do
+        for order in "${ORDERS[@]}"; do
+            for location in "${LOCATIONS[@]}"; do
+                for scale in "${SCALES[@]}"; do
+                    for program in progA progB; do
+                        run_atomic_benchmark "$program" "$op" "$order" "$location" "$scale" || true
+                    done
+                done
+            done
+        done
+    done
+
+    sweep_done "Atomic memory-ordering sweep"
+    echo "NsPerOp is the latency of one operation in one worker; compare shared vs"
+    echo "private rows for the cost of contention, and LostUpdates must be 0."
+}
+
+main "$@"
@@ -0,0 +1,61 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for BSP barrier results
+OUTPUT_CSV="MT25081_Part_D_bsp_CSV.csv"
+CSV_COLUMNS="Program,Barrier,Workers,CPUs,Supersteps,SliceTerms,Compute_ns,Barrier_ns,BarrierMax_ns,Step_ns,Efficiency_Pct,Ideal_Pct,ExitStatus"
+RESULT_LINE="BSP_RESULT"
+
+# Barrier implementations and worker counts to sweep.
+BARRIERS=(${BARRIERS:-pthread sense dissem futex})
+SCALES=(${SCALES:-2 4 8 16 32 64 100})
+
+# Supersteps per run and Leibniz terms per compute slice (0 = bare barrier).
+SUPERSTEPS=${SUPERSTEPS:-500}
+BSP_SLICE=${BSP_SLICE:-20000}
+
+# CPUs the runs are pinned to (default: core 0, oversubscribed like Part D).
+CPU_LIST=${CPU_LIST:-0}
+
+# Runs one barrier/worker-count configuration and appends a CSV row.
+run_bsp_benchmark() {
+    local program=$1
+    local barrier=$2
+    local scale=$3
+    local log="$LOG_DIR/bsp_${program}_${barrier}_${scale}.log"
+
+    echo -e "${CYAN}  Running: $program bsp scale=$scale barrier=$barrier${NC}"
+
+    run_logged "$log" "$PROJECT_DIR/$program" bsp "$scale" --barrier="$barrier" \
+        --supersteps="$SUPERSTEPS" --bsp-slice="$BSP_SLICE"
+
+    local fields
+    fields=$(result_fields "$log" compute_ns barrier_ns barrier_max_ns step_ns efficiency_pct ideal_pct)
+    append_row "$program,$barrier,$scale,$(result_field "$log" cpus),$SUPERSTEPS,$BSP_SLICE$fields,$RUN_STATUS"
+}
+
+main() {
+    print_banner "BSP BARRIERS - PROCESSES VS THREADS" \
+        "Compare barrier latency and BSP efficiency vs N for" \
+        "pthread, sense-reversing, dissemination, futex."
+    require_programs progA progB
+
+    echo -e "${YELLOW}CPUs: $CPU_LIST, supersteps: $SUPERSTEPS, slice: $BSP_SLICE terms${NC}"
+    init_csv
+
+    for barrier in "${BARRIERS[@]}"; do
+        for scale in "${SCALES[@]}"; do
+            for program in progA progB; do
+                run_bsp_benchmark "$program" "$barrier" "$scale" || true
+            done
+        done
+    done
+
+    sweep_done "BSP barrier sweep"
+    echo "Barrier latency = Barrier_ns (use BSP_SLICE=0 for the bare barrier cost);"
+    echo "compare Efficiency_Pct with Ideal_Pct to see the overhead beyond oversubscription."
+}
+
+main "$@"
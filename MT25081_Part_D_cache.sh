@@ -0,0 +1,113 @@
+# Result cache helpers, sourced by MT25081_Part_D_scaling.sh.
+#
+# Every run of the sweep produces one CSV row. The row is stored under a key
+# that hashes everything the measurement depends on:
+#   - the binary: sha256 of its contents (so a rebuild that changes nothing
+#     keeps its entries, and any code or flag change invalidates them), and
+#     of ./timeline when TIMELINE_INTERVAL_MS wraps the run in it
+#   - the configuration: program, worker, scale, variant, CPU pin list,
+#     TARGET_SECONDS, TIMELINE_INTERVAL_MS, SMAPS, PSI_CGROUP/PSI_INTERVAL,
+#     the CSV schema and the runner scripts themselves
+#   - the host fingerprint: kernel release, CPU model, CPU count, MemTotal
+#
+# A rerun only executes configurations whose key has no entry; the CSV is
+# assembled from cached rows in sweep order, so it is identical to a full run.
+#
+# RESULT_CACHE=0 disables the cache, RESULT_CACHE=refresh reruns everything
+# and overwrites the entries. Entries live in RESULT_CACHE_DIR (one file per
+# key); deleting the directory clears the cache.
+
+RESULT_CACHE=${RESULT_CACHE:-1}
+RESULT_CACHE_DIR=${RESULT_CACHE_DIR:-cache}
+
+# Hit/miss counters for the end-of-sweep summary.
+CACHE_HITS=0
+CACHE_MISSES=0
+
+# Binary hashes computed so far in this sweep (path -> sha256).
+declare -A CACHE_BINARY_HASH=()
+
+# Prints a fingerprint of the host the results were measured on.
+cache_host_fingerprint() {
+    local cpu_model
+    cpu_model=$(awk -F': ' '/^model name/ {print $2; exit}' /proc/cpuinfo 2>/dev/null)
+    local mem_total
+    mem_total=$(awk '/^MemTotal:/ {print $2; exit}' /proc/meminfo 2>/dev/null)
+    echo "kernel=$(uname -r) cpu=${cpu_model:-unknown} ncpu=$(nproc) mem_kb=${mem_total:-0}"
+}
+
+# Hash of the runner scripts (a change to how metrics are collected
+# invalidates every entry).
+CACHE_RUNNER_HASH=$(cat "$PROJECT_DIR/MT25081_Part_D_scaling.sh" "$PROJECT_DIR/MT25081_Part_C_psi.sh" \
+                        "$PROJECT_DIR/MT25081_Part_D_cache.sh" | sha256sum | cut -d' ' -f1)
+CACHE_HOST=$(cache_host_fingerprint)
+
+# Returns 0 when the result cache is enabled.
+cache_enabled() {
+    [[ "$RESULT_CACHE" != "0" ]]
+}
+
+# Prints the sha256 of a binary, hashing each path once per sweep.
+cache_binary_hash() {
+    local path=$1
+    if [[ -z "${CACHE_BINARY_HASH[$path]}" ]]; then
+        CACHE_BINARY_HASH[$path]=$(sha256sum "$path" | cut -d' ' -f1)
+    fi
+    echo "${CACHE_BINARY_HASH[$path]}"
+}
+
+# Sets CACHE_KEY for one run (a global, not printed, so that the binary
+# hash memo is filled in this shell rather than in a subshell).
+# Usage: cache_key <binary path> <program> <worker> <scale> <variant> <cpu list> [<omp schedule>]
+cache_key() {
+    local path=$1 program=$2 worker=$3 scale=$4 variant=$5 cpu_list=$6 schedule=${7:--}
+    cache_binary_hash "$path" > /dev/null
+    # ./timeline wraps the run when TIMELINE_INTERVAL_MS is set
+    local timeline_hash=""
+    if [[ -n "$TIMELINE_INTERVAL_MS" ]]; then
+        cache_binary_hash "$PROJECT_DIR/timeline" > /dev/null
+        timeline_hash=${CACHE_BINARY_HASH[$PROJECT_DIR/timeline]}
+    fi
+    CACHE_KEY=$({
+        echo "binary=${CACHE_BINARY_HASH[$path]} timeline=$timeline_hash"
+        echo "program=$program worker=$worker scale=$scale variant=$variant cpus=$cpu_list schedule=$schedule"
+        echo "target_seconds=$TARGET_SECONDS timeline_ms=$TIMELINE_INTERVAL_MS smaps=$SMAPS"
+        echo "psi_cgroup=$PSI_CGROUP psi_interval=$PSI_INTERVAL psi_header=$PSI_CSV_HEADER"
+        echo "omp_schedule=$OMP_SCHEDULE omp_proc_bind=$OMP_PROC_BIND omp_places=$OMP_PLACES"
+        echo "runner=$CACHE_RUNNER_HASH"
+        echo "host=$CACHE_HOST"
+    } | sha256sum | cut -d' ' -f1)
+}
+
+# Appends the cached row for a key to OUTPUT_CSV. Returns 1 on a miss.
+cache_lookup() {
+    local key=$1
+    local entry="$RESULT_CACHE_DIR/$key.row"
+    if ! cache_enabled || [[ "$RESULT_CACHE" == "refresh" || ! -s "$entry" ]]; then
+        CACHE_MISSES=$((CACHE_MISSES+1))
+        return 1
+    fi
+    cat "$entry" >> "$OUTPUT_CSV"
+    CACHE_HITS=$((CACHE_HITS+1))
+    return 0
+}
+
+# Stores a result row under a key (written to a temp file and renamed, so an
+# interrupted sweep never leaves a truncated entry).
+cache_store() {
+    local key=$1
+    local row=$2
+    cache_enabled || return 0
+    mkdir -p "$RESULT_CACHE_DIR"
+    echo "$row" > "$RESULT_CACHE_DIR/$key.row.tmp"
+    mv "$RESULT_CACHE_DIR/$key.row.tmp" "$RESULT_CACHE_DIR/$key.row"
+}
+
+# Prints the hit/miss summary for the sweep.
+cache_summary() {
+    if cache_enabled; then
+        echo "Result cache: $CACHE_HITS reused, $CACHE_MISSES executed ($RESULT_CACHE_DIR/)"
+    else
+        echo "Result cache: disabled (RESULT_CACHE=0)"
+    fi
+}
@@ -0,0 +1,112 @@
+# Sweep helpers shared by the Part D result-line scripts (mempressure, bsp,
+# imbalance, atomic, latency, signal, fdchurn, cow, kmem, startup), sourced
+# after the script has set PROJECT_DIR.
+#
+# A sweep script only declares its sweep and its columns:
+#   OUTPUT_CSV   result file, rewritten by init_csv
+#   CSV_COLUMNS  its header line
+#   RESULT_LINE  result line the columns come from, e.g. "BSP_RESULT"
+#   CPU_LIST     CPUs every run is pinned to with taskset (unset = no pinning)
+# and per configuration calls run_logged, then builds its row with
+# result_fields and writes it with append_row. Every row ends with the 12
+# PSI columns of its run (MT25081_Part_C_psi.sh), after the script's own.
+
+source "$PROJECT_DIR/MT25081_Part_C_psi.sh"
+
+# Log directory for per-run program output
+LOG_DIR="logs"
+
+# Color codes for terminal output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+CYAN='\033[0;36m'
+NC='\033[0m'
+
+# Create log directory if it doesn't exist
+mkdir -p "$LOG_DIR"
+
+# Prints the start banner: title and a two-line objective.
+print_banner() {
+    local title=$1
+    local objective=$2
+    local objective2=$3
+    echo -e "${GREEN}"
+    echo "╔════════════════════════════════════════════════════════════════════╗"
+    printf "║  %-66s║\n" "PA01 PART D: $title"
+    printf "║  %-66s║\n" "Roll Number: 25081"
+    printf "║  %-66s║\n" ""
+    printf "║  %-66s║\n" "Objective: $objective"
+    printf "║  %-66s║\n" "           $objective2"
+    echo "╚════════════════════════════════════════════════════════════════════╝"
+    echo -e "${NC}"
+}
+
+# Exits unless every named program has been built.
+require_programs() {
+    local program
+    for program in "$@"; do
+        if [[ ! -f "$PROJECT_DIR/$program" ]]; then
+            echo -e "${RED}ERROR: $program not found. Build with 'make'${NC}"
+            exit 1
+        fi
+    done
+}
+
+# Initializes the CSV file with the script's columns and the PSI columns.
+init_csv() {
+    echo "$CSV_COLUMNS,$PSI_CSV_HEADER" > "$OUTPUT_CSV"
+}
+
+# Runs a command with stdout and stderr in a log, pinned to CPU_LIST when it
+# is set. Sets RUN_STATUS to the exit status; a failed run never stops the sweep.
+# Sets RUN_PSI to the run's PSI fields: stall totals from snapshots around the
+# run, avg10 from a sampler logging to <log>.psi.tmp meanwhile.
+run_logged() {
+    local log=$1
+    shift
+    local pin=()
+    if [[ -n "$CPU_LIST" ]]; then
+        pin=(taskset -c "$CPU_LIST")
+    fi
+    local psi_log="${log%.log}.psi.tmp"
+    local psi_start
+    psi_start=$(psi_snapshot)
+    psi_sampler_start "$psi_log"
+    RUN_STATUS=0
+    "${pin[@]}" "$@" > "$log" 2>&1 || RUN_STATUS=$?
+    psi_sampler_stop
+    RUN_PSI=$(psi_csv_fields "$psi_start" "$(psi_snapshot)" "$psi_log")
+}
+
+# Extracts "key=value" from the last line of the log matching a pattern
+# (default: the " $RESULT_LINE " line).
+result_field() {
+    local log=$1
+    local key=$2
+    local pattern=${3:-" $RESULT_LINE "}
+    grep "$pattern" "$log" | tail -n 1 | tr ' ' '\n' | awk -F= -v k="$key" '$1 == k { print $2 }'
+}
+
+# Prints ",value" for each key of the log's RESULT_LINE, in order, so a row
+# is "$fixed_columns$(result_fields "$log" key...),$RUN_STATUS".
+result_fields() {
+    local log=$1
+    shift
+    local key fields=""
+    for key in "$@"; do
+        fields="$fields,$(result_field "$log" "$key")"
+    done
+    echo "$fields"
+}
+
+# Appends a row and the last run's PSI fields to the CSV.
+append_row() {
+    echo "$1,$RUN_PSI" >> "$OUTPUT_CSV"
+}
+
+# Prints the closing lines of a sweep.
+sweep_done() {
+    echo -e "${GREEN}✓ $1 completed${NC}"
+    echo "Results saved to: $OUTPUT_CSV"
+}
@@ -0,0 +1,76 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for copy-on-write dataset results
+OUTPUT_CSV="MT25081_Part_D_cow_CSV.csv"
+CSV_COLUMNS="Program,DatasetMB,WriteFraction,Workers,Processes,Lookups,Wall_s,MLookupsPerSec,CowFaults,DirtyMsMax,RssTotalMB,PssTotalMB,UssTotalMB,PssPerWorkerMB,ExitStatus"
+RESULT_LINE="COW_RESULT"
+
+# Fractions of pages each worker modifies, and worker counts to sweep.
+WRITES=(${WRITES:-0 0.01 0.1 0.5})
+SCALES=(${SCALES:-1 2 4 8 16})
+
+# Dataset size (MB), batches per run and lookups per batch.
+DATASET_MB=${DATASET_MB:-256}
+COW_BATCHES=${COW_BATCHES:-20}
+COW_LOOKUPS=${COW_LOOKUPS:-1000000}
+
+# CPUs the runs are pinned to (default: none).
+CPU_LIST=${CPU_LIST:-}
+
+# Prints 1 if progA's copies (DATASET_MB * (1 + N * F)) fit in MemAvailable.
+fits_in_memory() {
+    local write=$1
+    local scale=$2
+    local avail_mb=$(( $(awk '/^MemAvailable:/ { print $2 }' /proc/meminfo) / 1024 ))
+    awk -v m="$DATASET_MB" -v f="$write" -v n="$scale" -v a="$avail_mb" \
+        'BEGIN { print (m * (1 + n * f) < 0.8 * a) ? 1 : 0 }'
+}
+
+# Runs one write-fraction/worker-count configuration and appends a CSV row.
+run_cow_benchmark() {
+    local program=$1
+    local write=$2
+    local scale=$3
+    local log="$LOG_DIR/cow_${program}_${write}_${scale}.log"
+
+    echo -e "${CYAN}  Running: $program cow scale=$scale write=$write${NC}"
+
+    run_logged "$log" "$PROJECT_DIR/$program" cow "$scale" --dataset-mb="$DATASET_MB" \
+        --cow-write="$write" --cow-batches="$COW_BATCHES" --cow-lookups="$COW_LOOKUPS"
+
+    local fields
+    fields=$(result_fields "$log" processes lookups wall_s mlookups_per_s cow_faults dirty_ms_max \
+             rss_total_mb pss_total_mb uss_total_mb pss_per_worker_mb)
+    append_row "$program,$DATASET_MB,$write,$scale$fields,$RUN_STATUS"
+}
+
+main() {
+    print_banner "COPY-ON-WRITE SHARED DATASET" \
+        "fork-shared (COW) table in processes vs one table" \
+        "shared by threads: faults, PSS/USS and throughput."
+    require_programs progA progB
+
+    echo -e "${YELLOW}Dataset: $DATASET_MB MB, batches: $COW_BATCHES x $COW_LOOKUPS lookups${NC}"
+    init_csv
+
+    for write in "${WRITES[@]}"; do
+        for scale in "${SCALES[@]}"; do
+            if [[ $(fits_in_memory "$write" "$scale") != 1 ]]; then
+                echo -e "${YELLOW}  Skipping scale=$scale write=$write: progA copies exceed MemAvailable${NC}"
+                continue
+            fi
+            for program in progA progB; do
+                run_cow_benchmark "$program" "$write" "$scale" || true
+            done
+        done
+    done
+
+    sweep_done "Copy-on-write sweep"
+    echo "PssTotalMB is the honest footprint; RssTotalMB counts the shared table"
+    echo "once per progA child."
+}
+
+main "$@"
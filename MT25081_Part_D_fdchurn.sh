@@ -0,0 +1,62 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for descriptor churn results
+OUTPUT_CSV="MT25081_Part_D_fdchurn_CSV.csv"
+CSV_COLUMNS="Program,Kind,Workers,CPUs,Ops,Wall_s,OpsPerSec,NsPerOp,ExitStatus"
+RESULT_LINE="FDCHURN_RESULT"
+
+# Descriptor kinds and worker counts to sweep.
+KINDS=(${KINDS:-file pipe eventfd mix})
+SCALES=(${SCALES:-1 2 4 8 16 32})
+
+# Batches per run and open/dup/close cycles per batch.
+FD_BATCHES=${FD_BATCHES:-200}
+FD_BATCH=${FD_BATCH:-1000}
+
+# CPUs the runs may use (default: all; the shared fd table only contends
+# when threads really run in parallel).
+CPU_LIST=${CPU_LIST:-0-$(($(nproc) - 1))}
+
+# Runs one kind/worker-count configuration and appends a CSV row.
+run_fdchurn_benchmark() {
+    local program=$1
+    local kind=$2
+    local scale=$3
+    local log="$LOG_DIR/fdchurn_${program}_${kind}_${scale}.log"
+
+    echo -e "${CYAN}  Running: $program fdchurn scale=$scale kind=$kind${NC}"
+
+    run_logged "$log" "$PROJECT_DIR/$program" fdchurn "$scale" --fd-kind="$kind" \
+        --fd-batches="$FD_BATCHES" --fd-batch="$FD_BATCH"
+
+    local fields
+    fields=$(result_fields "$log" cpus ops wall_s ops_per_s ns_per_op)
+    append_row "$program,$kind,$scale$fields,$RUN_STATUS"
+}
+
+main() {
+    print_banner "FD TABLE CHURN - PROCESSES VS THREADS" \
+        "open/dup/close rate on one shared fd table (threads)" \
+        "vs private fd tables (processes) as N grows."
+    require_programs progA progB
+
+    echo -e "${YELLOW}CPUs: $CPU_LIST, batches: $FD_BATCHES x $FD_BATCH cycles${NC}"
+    init_csv
+
+    for kind in "${KINDS[@]}"; do
+        for scale in "${SCALES[@]}"; do
+            for program in progA progB; do
+                run_fdchurn_benchmark "$program" "$kind" "$scale" || true
+            done
+        done
+    done
+
+    sweep_done "Descriptor churn sweep"
+    echo "Compare OpsPerSec of progA and progB at the same N: the gap is the cost"
+    echo "of the shared fd table."
+}
+
+main "$@"
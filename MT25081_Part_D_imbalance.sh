@@ -0,0 +1,67 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for load-imbalance results
+OUTPUT_CSV="MT25081_Part_D_imbalance_CSV.csv"
+CSV_COLUMNS="Program,Distribution,Schedule,Chunk,Workers,Tasks,TaskCost,TaskKernel,Rounds,Makespan_ms,IdleMean_ms,IdleMax_ms,Idle_Pct,JainIndex,ExitStatus"
+RESULT_LINE="IMBALANCE_RESULT"
+
+# Cost distributions, schedules (policy[,chunk]) and worker counts to sweep.
+DISTS=(${DISTS:-uniform exp pareto})
+SCHEDULES=(${SCHEDULES:-static dynamic,1 dynamic,16 guided,1})
+SCALES=(${SCALES:-4 8})
+
+# Task set: tasks per round, mean cost, task kernel (cpu|mem) and rounds.
+TASKS=${TASKS:-1000}
+TASK_COST=${TASK_COST:-20000}
+TASK_KERNEL=${TASK_KERNEL:-cpu}
+ROUNDS=${ROUNDS:-10}
+
+# CPUs the runs may use (default: all; set e.g. CPU_LIST=0 to oversubscribe).
+CPU_LIST=${CPU_LIST:-0-$(($(nproc) - 1))}
+
+# Runs one distribution/schedule/worker-count configuration and appends a CSV row.
+run_imbalance_benchmark() {
+    local program=$1
+    local dist=$2
+    local schedule=$3
+    local scale=$4
+    local log="$LOG_DIR/imbalance_${program}_${dist}_${schedule/,/_}_${scale}.log"
+
+    echo -e "${CYAN}  Running: $program imbalance scale=$scale dist=$dist schedule=$schedule${NC}"
+
+    run_logged "$log" "$PROJECT_DIR/$program" imbalance "$scale" --dist="$dist" \
+        --schedule="$schedule" --tasks="$TASKS" --task-cost="$TASK_COST" \
+        --task-kernel="$TASK_KERNEL" --rounds="$ROUNDS"
+
+    local fields
+    fields=$(result_fields "$log" makespan_ms idle_mean_ms idle_max_ms idle_pct jain)
+    append_row "$program,$dist,$(result_field "$log" schedule),$(result_field "$log" chunk),$scale,$TASKS,$TASK_COST,$TASK_KERNEL,$ROUNDS$fields,$RUN_STATUS"
+}
+
+main() {
+    print_banner "LOAD IMBALANCE - PROCESSES VS THREADS" \
+        "Skewed task costs under static, dynamic and guided" \
+        "scheduling: makespan, idle time, Jain's fairness."
+    require_programs progA progB
+
+    echo -e "${YELLOW}CPUs: $CPU_LIST, $TASKS $TASK_KERNEL tasks of mean cost $TASK_COST, $ROUNDS rounds${NC}"
+    init_csv
+
+    for dist in "${DISTS[@]}"; do
+        for schedule in "${SCHEDULES[@]}"; do
+            for scale in "${SCALES[@]}"; do
+                for program in progA progB; do
+                    run_imbalance_benchmark "$program" "$dist" "$schedule" "$scale" || true
+                done
+            done
+        done
+    done
+
+    sweep_done "Load-imbalance sweep"
+    echo "Lower Makespan_ms and Idle_Pct and a JainIndex near 1.0 mean better balance."
+}
+
+main "$@"
@@ -0,0 +1,91 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for kernel memory results
+OUTPUT_CSV="MT25081_Part_D_kmem_CSV.csv"
+CSV_COLUMNS="Program,Workers,Procs,PageTablesKB,KernelStackKB,SlabKB,TotalKB,PerWorkerKB,SlabinfoKB,TaskStructObjs,ExitStatus"
+RESULT_LINE="KMEM_RESULT"
+
+# Idle worker counts to sweep (BENCH_MAX_WORKERS is 100).
+SCALES=(${SCALES:-1 10 25 50 75 100})
+
+# Processes progH spreads the workers over.
+HYBRID_PROCS=${HYBRID_PROCS:-4}
+
+# Length of the idle workers' sleep (ms); the snapshot is taken before it.
+IDLE_MS=${IDLE_MS:-100}
+
+# CPUs the runs are pinned to (default: none).
+CPU_LIST=${CPU_LIST:-}
+
+# Runs one program/worker-count configuration and appends a CSV row.
+run_kmem_benchmark() {
+    local program=$1
+    local scale=$2
+    local procs=$3
+    local log="$LOG_DIR/kmem_${program}_${scale}.log"
+
+    echo -e "${CYAN}  Running: $program idle scale=$scale procs=$procs${NC}"
+
+    run_logged "$log" "$PROJECT_DIR/$program" idle "$scale" --kmem --idle-ms="$IDLE_MS" \
+        --procs="$HYBRID_PROCS"
+
+    local fields
+    fields=$(result_fields "$log" page_tables_kb kernel_stack_kb slab_kb total_kb per_worker_kb slabinfo_kb)
+    local tasks
+    tasks=$(result_field "$log" objs "KMEM_SLAB cache=task_struct ")
+    append_row "$program,$scale,$procs$fields,$tasks,$RUN_STATUS"
+}
+
+# Prints the least-squares slope of TotalKB over Workers per program: the
+# kernel memory one more worker costs, with the fixed per-run noise removed.
+print_slopes() {
+    awk -F, 'NR > 1 && $11 == 0 {
+                 n[$1]++; x[$1] += $2; y[$1] += $7; xx[$1] += $2 * $2; xy[$1] += $2 * $7
+             }
+             END {
+                 for (p in n) {
+                     d = n[p] * xx[p] - x[p] * x[p]
+                     if (d > 0) {
+                         printf "  %s: %.1f kB per worker\n", p, (n[p] * xy[p] - x[p] * y[p]) / d
+                     }
+                 }
+             }' "$OUTPUT_CSV"
+}
+
+main() {
+    print_banner "KERNEL MEMORY PER WORKER" \
+        "page tables, kernel stacks and slab objects of N idle" \
+        "processes, threads and processes of threads."
+    require_programs progA progB
+    if [[ ! -r /proc/slabinfo ]]; then
+        echo -e "${YELLOW}/proc/slabinfo is not readable (run as root for per-cache counts)${NC}"
+    fi
+
+    init_csv
+
+    local programs=(progA progB)
+    if [[ -f "$PROJECT_DIR/progH" ]]; then
+        programs+=(progH)
+    fi
+
+    for scale in "${SCALES[@]}"; do
+        for program in "${programs[@]}"; do
+            local procs=$scale
+            if [[ "$program" == "progB" ]]; then
+                procs=1
+            elif [[ "$program" == "progH" ]]; then
+                procs=$(( HYBRID_PROCS < scale ? HYBRID_PROCS : scale ))
+            fi
+            run_kmem_benchmark "$program" "$scale" "$procs" || true
+        done
+    done
+
+    sweep_done "Kernel memory sweep"
+    echo "Kernel memory per extra worker (slope of TotalKB over Workers):"
+    print_slopes
+}
+
+main "$@"
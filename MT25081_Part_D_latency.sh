@@ -0,0 +1,76 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for wakeup latency results (histograms go to LOG_DIR)
+OUTPUT_CSV="MT25081_Part_D_latency_CSV.csv"
+CSV_COLUMNS="Program,Worker_Type,Workers,WorkerPolicy,ProbePolicy,Priority,Period_us,Samples,Min_us,Avg_us,P50_us,P99_us,P999_us,Max_us,Overflows,ExitStatus"
+RESULT_LINE="LATENCY_RESULT"
+
+# Background workers, background worker counts and probe policies to sweep.
+WORKERS=(${WORKERS:-cpu mem io})
+SCALES=(${SCALES:-1 2 4 8 16})
+POLICIES=(${POLICIES:-other fifo})
+
+# Probe period and how long each background run lasts (calibrated).
+PERIOD_US=${PERIOD_US:-1000}
+TARGET_SECONDS=${TARGET_SECONDS:-5}
+
+# Optional policy for the background workers (batch|idle, applied with chrt).
+WORKER_POLICY=${WORKER_POLICY:-}
+
+# CPUs the probe and the workers share (default: core 0, like Part D).
+CPU_LIST=${CPU_LIST:-0}
+
+# Runs one background-load/probe-policy configuration and appends a CSV row.
+run_latency_benchmark() {
+    local program=$1
+    local worker=$2
+    local scale=$3
+    local policy=$4
+    local name="latency_${program}_${worker}_${scale}_${policy}"
+    local log="$LOG_DIR/$name.log"
+
+    echo -e "${CYAN}  Running: $program $worker scale=$scale probe=$policy${NC}"
+
+    # Background workers under WORKER_POLICY; the probe sets its own policy
+    local launcher=()
+    if [[ -n "$WORKER_POLICY" ]]; then
+        launcher=(chrt "--$WORKER_POLICY" 0)
+    fi
+
+    run_logged "$log" "${launcher[@]}" "$PROJECT_DIR/$program" "$worker" "$scale" \
+        --target-seconds="$TARGET_SECONDS" --latency-probe="$PERIOD_US" \
+        --probe-policy="$policy" --latency-hist="$LOG_DIR/$name.hist.csv"
+
+    local fields
+    fields=$(result_fields "$log" samples min_us avg_us p50_us p99_us p999_us max_us overflows)
+    append_row "$program,$worker,$scale,${WORKER_POLICY:-other},$policy,$(result_field "$log" priority),$PERIOD_US$fields,$RUN_STATUS"
+}
+
+main() {
+    print_banner "TIMER WAKEUP LATENCY UNDER BACKGROUND LOAD" \
+        "Max and p99 wakeup latency of a periodic timer vs" \
+        "background worker count and scheduling policy."
+    require_programs progA progB
+
+    echo -e "${YELLOW}CPUs: $CPU_LIST, period: $PERIOD_US us, ${TARGET_SECONDS}s per run, workers: ${WORKER_POLICY:-other}${NC}"
+    init_csv
+
+    for worker in "${WORKERS[@]}"; do
+        for scale in "${SCALES[@]}"; do
+            for policy in "${POLICIES[@]}"; do
+                for program in progA progB; do
+                    run_latency_benchmark "$program" "$worker" "$scale" "$policy" || true
+                done
+            done
+        done
+    done
+
+    sweep_done "Wakeup latency sweep"
+    echo "Histograms: $LOG_DIR/latency_*.hist.csv"
+    echo "fifo/rr probes need CAP_SYS_NICE; rows with ExitStatus != 0 were not measured."
+}
+
+main "$@"
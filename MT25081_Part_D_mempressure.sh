@@ -0,0 +1,80 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for memory-pressure results
+OUTPUT_CSV="MT25081_Part_D_mempressure_CSV.csv"
+CSV_COLUMNS="Program,Worker_Type,Scale,MemFraction,MemMax,MajorFaults,SwapIn_Pages,SwapOut_Pages,PSI_MemSome_us,PSI_MemFull_us,Throughput_MBps,ExecutionTime_Sec,ExitStatus"
+RESULT_LINE="RESULT"
+
+# Footprints to sweep, as a fraction of MemTotal, or of MEM_MAX when that is
+# lower (split across all workers). Fractions above 0.9 are only run inside
+# a memory.max cgroup (see MEM_MAX).
+FRACTIONS=(${FRACTIONS:-0.25 0.50 0.75 0.90 1.10 1.25})
+
+# Number of workers and sweeps over each worker's array per run.
+SCALE=${SCALE:-4}
+MEM_PASSES=${MEM_PASSES:-20}
+
+# Optional cgroup limit (e.g. MEM_MAX=2G). When set, each run is started in
+# a transient systemd scope with MemoryMax=$MEM_MAX so reclaim and swap
+# happen inside the cgroup instead of triggering the host OOM killer.
+MEM_MAX=${MEM_MAX:-}
+
+# CPUs the runs are pinned to (default: none).
+CPU_LIST=${CPU_LIST:-}
+
+# Runs one memory-pressure configuration and appends a CSV row.
+run_pressure_benchmark() {
+    local program=$1
+    local fraction=$2
+    local log="$LOG_DIR/mempressure_${program}_${fraction}.log"
+
+    echo -e "${CYAN}  Running: $program mem scale=$SCALE fraction=$fraction${NC}"
+
+    # Wrap the run in a memory-limited scope when MEM_MAX is set.
+    local launcher=()
+    if [[ -n "$MEM_MAX" ]]; then
+        launcher=(systemd-run --quiet --scope -p "MemoryMax=$MEM_MAX")
+    fi
+
+    run_logged "$log" "${launcher[@]}" "$PROJECT_DIR/$program" mem "$SCALE" \
+        --mem-fraction="$fraction" --mem-passes="$MEM_PASSES"
+
+    local fields
+    fields=$(result_fields "$log" majflt pswpin pswpout psi_mem_some_us psi_mem_full_us \
+             throughput_mbps elapsed_s)
+    append_row "$program,mem,$SCALE,$fraction,${MEM_MAX:-none}$fields,$RUN_STATUS"
+}
+
+main() {
+    print_banner "MEMORY PRESSURE - PROCESSES VS THREADS" \
+        "Size mem_worker as a fraction of MemTotal/memory.max" \
+        "and measure faults, swap, memory PSI and throughput."
+    require_programs progA progB
+
+    if [[ -n "$MEM_MAX" ]] && ! command -v systemd-run &> /dev/null; then
+        echo -e "${RED}ERROR: MEM_MAX needs systemd-run to create a memory.max cgroup${NC}"
+        exit 1
+    fi
+
+    echo -e "${YELLOW}MemTotal: $(awk '/^MemTotal:/ {print $2}' /proc/meminfo) kB, memory.max: ${MEM_MAX:-none}${NC}"
+    init_csv
+
+    for fraction in "${FRACTIONS[@]}"; do
+        # Without a cgroup limit, never push the host itself past its RAM.
+        if [[ -z "$MEM_MAX" ]] && awk -v f="$fraction" 'BEGIN { exit !(f > 0.9) }'; then
+            echo -e "${YELLOW}  Skipping fraction $fraction (set MEM_MAX to run above 0.9)${NC}"
+            continue
+        fi
+        for program in progA progB; do
+            run_pressure_benchmark "$program" "$fraction" || true
+        done
+    done
+
+    sweep_done "Memory-pressure sweep"
+    echo "Throughput degradation = Throughput_MBps relative to the smallest fraction."
+}
+
+main "$@"
@@ -8,6 +8,11 @@ OUTPUT_CSV="MT25081_Part_D_CSV.csv"
 # Log directory for temporary metric files
 LOG_DIR="logs"
 
+# SMAPS=1 adds --smaps and fills the PSS/USS columns. Off by default: the
+# smaps barrier holds every worker at its peak until all arrive, which
+# changes the time, CPU and memory figures of the baseline runs.
+SMAPS=${SMAPS:-0}
+
 # Detect number of CPU cores (for reference only)
 CPU_CORES=$(nproc)
 
@@ -21,11 +26,17 @@ NC='\033[0m'
 # Create log directory if it doesn't exist
 mkdir -p "$LOG_DIR"
 
+# Pressure Stall Information helpers (PSI columns for every result row)
+source "$PROJECT_DIR/MT25081_Part_C_psi.sh"
+
+# Result cache (rerun only configurations whose binary/config/host changed)
+source "$PROJECT_DIR/MT25081_Part_D_cache.sh"
+
 # Checks for the presence of required command-line tools.
 # Exits with an error message if any critical tool is missing.
 check_commands() {
     echo -e "${YELLOW}Checking for required tools...${NC}"
-    local required_commands=("iostat" "top" "taskset" "pgrep" "bc" "nproc")
+    local required_commands=("iostat" "top" "taskset" "setsid" "pgrep" "bc" "nproc")
     local missing_commands=()
 
     for cmd in "${required_commands[@]}"; do
@@ -54,7 +65,10 @@ check_commands() {
 # Initializes the CSV file with headers matching the new data collection format.
 init_csv() {
     # This header includes absolute memory in KB and I/O in KB.
-    echo "Program,Worker_Type,Scale,AvgCPU_Percent,AvgMemory_KB,TotalIO_KB,ExecutionTime_Sec" > "$OUTPUT_CSV"
+    # PssTotal_KB/UssTotal_KB come from the program's --smaps MEM_RESULT line (SMAPS=1):
+    # unlike the summed top RES, shared pages are not counted once per child.
+    # OmpSchedule is progO's OMP_SCHEDULE, "," as ":" ("-" for progA/progB).
+    echo "Program,Worker_Type,Scale,AvgCPU_Percent,AvgMemory_KB,TotalIO_KB,ExecutionTime_Sec,$PSI_CSV_HEADER,Variant,Calibrated_Count,PssTotal_KB,UssTotal_KB,OmpSchedule" > "$OUTPUT_CSV"
 }
 
 # Runs a single scaling benchmark test.
@@ -62,7 +76,21 @@ run_scaling_benchmark() {
     local program=$1
     local worker=$2
     local scale=$3
-    local program_path="$PROJECT_DIR/$program"
+    local variant=${4:-base}
+    local schedule=${5:--}
+    # Build variant binaries carry a suffix (progA.lto, progB.pgo, ...)
+    local binary=$program
+    if [[ "$variant" != "base" ]]; then
+        binary="$program.$variant"
+    fi
+    local program_path="$PROJECT_DIR/$binary"
+    # Per-run file names; progO runs also differ by OpenMP schedule
+    local run="${binary}_${worker}_${scale}"
+    local omp_env=()
+    if [[ "$schedule" != "-" ]]; then
+        run="${binary}_${schedule/,/-}_${worker}_${scale}"
+        omp_env=(env "OMP_SCHEDULE=$schedule")
+    fi
     
     # ====== PHASE 1: VALIDATION ======
     if [[ ! -f "$program_path" ]]; then
@@ -70,21 +98,63 @@ run_scaling_benchmark() {
         return 1
     fi
     
-    echo -e "${CYAN}  Running: $program $worker scale=$scale${NC}"
-    
     # ====== PHASE 2: CPU PINNING ======
     # Pin to a SINGLE CORE ('0') to analyze contention and scaling on a fixed resource.
     # This is critical for comparing thread vs. process efficiency under constraint.
     local cpu_list="0"
 
+    # Reuse the stored row when neither the binary nor the configuration
+    # (nor the host) changed since it was measured.
+    cache_key "$program_path" "$program" "$worker" "$scale" "$variant" "$cpu_list" "$schedule"
+    local key=$CACHE_KEY
+    if cache_lookup "$key"; then
+        echo -e "${GREEN}  Cached:  $binary $worker scale=$scale schedule=$schedule${NC}"
+        return 0
+    fi
+
+    echo -e "${CYAN}  Running: $binary $worker scale=$scale schedule=$schedule${NC}"
+
+    # When TARGET_SECONDS is set, a separate untimed run calibrates the work
+    # size so one worker runs for about that long (--calibrate-only). The
+    # measured run gets the count through --units, so the probe is not part
+    # of its time, CPU%, I/O or PSI; the count is recorded in the CSV.
+    local extra_args=()
+    if [[ "$SMAPS" == "1" ]]; then
+        extra_args+=("--smaps")
+    fi
+    local calibrated=fixed
+    if [[ -n "$TARGET_SECONDS" ]]; then
+        local calibrate_file="$LOG_DIR/calibrate_$run.log"
+        "${omp_env[@]}" taskset -c "$cpu_list" "$program_path" "$worker" 1 \
+            --target-seconds="$TARGET_SECONDS" --calibrate-only > "$calibrate_file" 2>&1 || true
+        calibrated=$(grep -o "CALIBRATION .* count=[0-9]*" "$calibrate_file" | sed 's/.*count=//')
+        if [[ -n "$calibrated" ]]; then
+            extra_args+=("--units=$calibrated")
+        else
+            echo -e "${YELLOW}  Calibration failed (see $calibrate_file); using the fixed work size${NC}"
+            calibrated=fixed
+        fi
+    fi
+
     # ====== PHASE 3: MONITORING & EXECUTION ======
     # Start background I/O monitoring with iostat.
-    iostat -dx 1 > "$LOG_DIR/io_${program}_${worker}_${scale}.tmp" &
+    iostat -dx 1 > "$LOG_DIR/io_$run.tmp" &
     local io_pid=$!
 
+    # Start PSI capture: cumulative stall totals now, avg10 every PSI_INTERVAL.
+    local psi_start=$(psi_snapshot)
+    psi_sampler_start "$LOG_DIR/psi_$run.tmp"
+
     # Use /usr/bin/time to measure wall-clock time and taskset to pin the process.
-    local time_file="$LOG_DIR/time_${program}_${worker}_${scale}.tmp"
-    /usr/bin/time -f "%e" taskset -c "$cpu_list" "$program_path" "$worker" "$scale" 2> "$time_file" &
+    local time_file="$LOG_DIR/time_$run.tmp"
+    # When TIMELINE_INTERVAL_MS is set, ./timeline records a per-worker
+    # resource timeline (CPU time, RSS, I/O bytes, context switches) for the run.
+    local timeline_cmd=()
+    if [[ -n "$TIMELINE_INTERVAL_MS" ]]; then
+        timeline_cmd=("$PROJECT_DIR/timeline" "$LOG_DIR/timeline_$run.csv" "$TIMELINE_INTERVAL_MS")
+    fi
+    local out_file="$LOG_DIR/out_$run.log"
+    /usr/bin/time -f "%e" "${omp_env[@]}" "${timeline_cmd[@]}" taskset -c "$cpu_list" "$program_path" "$worker" "$scale" "${extra_args[@]}" > "$out_file" 2> "$time_file" &
     local program_pid=$!
     echo "DEBUG: Started $program_path ($worker) with PID: $program_pid"
     
@@ -128,12 +198,20 @@ run_scaling_benchmark() {
         sleep 1 # Sample rate of 1 second.
     done
     echo "DEBUG: Program with PID $program_pid terminated."
+    # time exits with the program's status (128+N if killed by signal N);
+    # its stderr also holds the program's own, so it is not parsed for this.
+    local run_status=0
+    wait "$program_pid" || run_status=$?
 
     # ====== PHASE 4: COLLECT METRICS ======
     # Stop the iostat monitor.
     kill $io_pid 2>/dev/null || true
     wait $io_pid 2>/dev/null || true
 
+    # Stop PSI capture and build the PSI CSV fields for this run.
+    psi_sampler_stop
+    local psi_fields=$(psi_csv_fields "$psi_start" "$(psi_snapshot)" "$LOG_DIR/psi_$run.tmp")
+
     # Calculate average CPU usage.
     local avg_cpu=0.00
     if [[ $samples -gt 0 ]]; then
@@ -143,18 +221,29 @@ run_scaling_benchmark() {
     # Calculate total I/O writes (in KB) from the iostat log.
     # Column 9 is 'wkB/s' based on the observed iostat output.
     # We now filter for specific device prefixes to be more robust.
-    local total_io=$(grep -v "^Linux" "$LOG_DIR/io_${program}_${worker}_${scale}.tmp" | awk '/^(sd|nvme|xvd)/ {sum+=$9} END {print sum+0}')
+    local total_io=$(grep -v "^Linux" "$LOG_DIR/io_$run.tmp" | awk '/^(sd|nvme|xvd)/ {sum+=$9} END {print sum+0}')
     # Read execution time.
-    local exec_time=$(cat "$time_file")
+    # (time's line is the last one, after anything the program wrote to stderr)
+    local exec_time=$(tail -n 1 "$time_file")
+
+    # Proportional and unique memory of all processes at the workers' peak.
+    local mem_result=$(grep " MEM_RESULT " "$out_file" | tail -n 1)
+    local pss_total=$(echo "$mem_result" | grep -o "pss_total_kb=[0-9]*" | cut -d= -f2)
+    local uss_total=$(echo "$mem_result" | grep -o "uss_total_kb=[0-9]*" | cut -d= -f2)
 
     # ====== PHASE 5: APPEND TO CSV ======
     # Append the collected metrics to the main CSV file.
-    echo "$program,$worker,$scale,$avg_cpu,$mem_max,$total_io,$exec_time" >> "$OUTPUT_CSV"
+    local row="$program,$worker,$scale,$avg_cpu,$mem_max,$total_io,$exec_time,$psi_fields,$variant,$calibrated,$pss_total,$uss_total,${schedule/,/:}"
+    echo "$row" >> "$OUTPUT_CSV"
+    # Only successful runs are cached.
+    if [[ $run_status -eq 0 ]]; then
+        cache_store "$key" "$row"
+    fi
     
     # ====== CLEANUP ======
     # Remove temporary metric files for this run.
-    # rm -f "$LOG_DIR/io_${program}_${worker}_${scale}.tmp" # Commented out for debugging
-    rm -f "$LOG_DIR/time_${program}_${worker}_${scale}.tmp"
+    # rm -f "$LOG_DIR/io_$run.tmp" # Commented out for debugging
+    rm -f "$time_file"
 }
 
 main() {
@@ -194,32 +283,54 @@ main() {
     declare -a scales_progA=(2 3 4 5)
     # Define scaling range for progB (threads), matching reference.
     declare -a scales_progB=(2 3 4 5 6 7 8)
+    # Build variants to sweep (see 'make variants'), e.g. "base native lto pgo".
+    declare -a variants=(${BINARY_VARIANTS:-base})
     
     echo -e "${YELLOW}Start Time: $(date '+%Y-%m-%d %H:%M:%S')${NC}"
     echo "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━"
     
     # Run scaling benchmarks for progA (processes).
     echo -e "${CYAN}Running scaling analysis for progA (Processes)...${NC}"
-    for scale in "${scales_progA[@]}"; do
-        for worker in "${workers[@]}"; do
-            run_scaling_benchmark "progA" "$worker" "$scale" || true
+    for variant in "${variants[@]}"; do
+        for scale in "${scales_progA[@]}"; do
+            for worker in "${workers[@]}"; do
+                run_scaling_benchmark "progA" "$worker" "$scale" "$variant" || true
+            done
         done
     done
     
     # Run scaling benchmarks for progB (threads).
     echo -e "${CYAN}Running scaling analysis for progB (Threads)...${NC}"
-    for scale in "${scales_progB[@]}"; do
-        for worker in "${workers[@]}"; do
-            run_scaling_benchmark "progB" "$worker" "$scale" || true
+    for variant in "${variants[@]}"; do
+        for scale in "${scales_progB[@]}"; do
+            for worker in "${workers[@]}"; do
+                run_scaling_benchmark "progB" "$worker" "$scale" "$variant" || true
+            done
         done
     done
     
+    # Run scaling benchmarks for progO (OpenMP) over the progB range, if built,
+    # once per OpenMP schedule (recorded in OmpSchedule, so the plots keep
+    # them apart). progO has no build variants; OMP_PROC_BIND/OMP_PLACES apply.
+    declare -a omp_schedules=(${OMP_SCHEDULES:-static dynamic guided})
+    if [[ -f "$PROJECT_DIR/progO" ]]; then
+        echo -e "${CYAN}Running scaling analysis for progO (OpenMP, schedules: ${omp_schedules[*]})...${NC}"
+        for schedule in "${omp_schedules[@]}"; do
+            for scale in "${scales_progB[@]}"; do
+                for worker in "${workers[@]}"; do
+                    run_scaling_benchmark "progO" "$worker" "$scale" base "$schedule" || true
+                done
+            done
+        done
+    fi
+    
     echo "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━"
     echo -e "${GREEN}✓ All scaling benchmarks completed successfully!${NC}"
     echo ""
     echo -e "${YELLOW}End Time: $(date '+%Y-%m-%d %H:%M:%S')${NC}"
     echo ""
     echo "Results saved to: $OUTPUT_CSV"
+    cache_summary
     echo ""
     echo "Next Steps:"
     echo "  1. Run 'python3 generate_plots.py' to create the graphs from the new CSV data."
@@ -227,6 +338,3 @@ main() {
 }
 
 main "$@"
-
-main "$@"
-
@@ -0,0 +1,72 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for signal delivery results
+OUTPUT_CSV="MT25081_Part_D_signal_CSV.csv"
+CSV_COLUMNS="Program,Send,Recv,Pattern,Workers,Signals,Send_ns,DeliverMean_us,DeliverP50_us,DeliverP99_us,DeliverMax_us,RttMean_us,RttP99_us,RttMax_us,ExitStatus"
+RESULT_LINE="SIGNAL_RESULT"
+
+# Send calls per program, consumption modes, patterns and worker counts.
+# kill only addresses processes and pthread_kill only threads.
+SENDS_PROGA=(${SENDS_PROGA:-kill tgkill})
+SENDS_PROGB=(${SENDS_PROGB:-tgkill pthread_kill})
+RECVS=(${RECVS:-handler sigwaitinfo signalfd})
+PATTERNS=(${PATTERNS:-ping broadcast})
+SCALES=(${SCALES:-1 10 50 100})
+
+# Signals per worker.
+SIGNALS=${SIGNALS:-200}
+
+# CPUs the runs may use (default: all; set e.g. CPU_LIST=0 to oversubscribe).
+CPU_LIST=${CPU_LIST:-0-$(($(nproc) - 1))}
+
+# Runs one send/recv/pattern/worker-count configuration and appends a CSV row.
+run_signal_benchmark() {
+    local program=$1
+    local send=$2
+    local recv=$3
+    local pattern=$4
+    local scale=$5
+    local log="$LOG_DIR/signal_${program}_${send}_${recv}_${pattern}_${scale}.log"
+
+    echo -e "${CYAN}  Running: $program signal scale=$scale send=$send recv=$recv pattern=$pattern${NC}"
+
+    run_logged "$log" "$PROJECT_DIR/$program" signal "$scale" --sig-send="$send" --sig-recv="$recv" \
+        --sig-pattern="$pattern" --signals="$SIGNALS"
+
+    local fields
+    fields=$(result_fields "$log" signals send_ns deliver_mean_us deliver_p50_us deliver_p99_us \
+             deliver_max_us rtt_mean_us rtt_p99_us rtt_max_us)
+    append_row "$program,$send,$recv,$pattern,$scale$fields,$RUN_STATUS"
+}
+
+main() {
+    print_banner "SIGNAL DELIVERY - PROCESSES VS THREADS" \
+        "Round-trip latency of kill/tgkill/pthread_kill with" \
+        "handler, sigwaitinfo and signalfd vs worker count."
+    require_programs progA progB
+
+    echo -e "${YELLOW}CPUs: $CPU_LIST, signals per worker: $SIGNALS${NC}"
+    init_csv
+
+    for recv in "${RECVS[@]}"; do
+        for pattern in "${PATTERNS[@]}"; do
+            for scale in "${SCALES[@]}"; do
+                for send in "${SENDS_PROGA[@]}"; do
+                    run_signal_benchmark progA "$send" "$recv" "$pattern" "$scale" || true
+                done
+                for send in "${SENDS_PROGB[@]}"; do
+                    run_signal_benchmark progB "$send" "$recv" "$pattern" "$scale" || true
+                done
+            done
+        done
+    done
+
+    sweep_done "Signal delivery sweep"
+    echo "Ping rows: Rtt_* is one round trip; broadcast rows: Rtt_* is the time to"
+    echo "signal every worker and collect every acknowledgement."
+}
+
+main "$@"
@@ -0,0 +1,73 @@
+set -e
+# Get project directory (where this script is located)
+PROJECT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+source "$PROJECT_DIR/MT25081_Part_D_common.sh"
+
+# Output CSV filename for startup latency results (per-launch CSVs go to LOG_DIR)
+OUTPUT_CSV="MT25081_Part_D_startup_CSV.csv"
+CSV_COLUMNS="Program,Link,Output,Launches,Failed,ExecToMainP50Us,ExecToMainP99Us,ExecToFirstWorkerP50Us,ExecToFirstWorkerP99Us,TimerInitP50Us,ExecToFirstWorkerNetP50Us,ExecToFirstWorkerNetP99Us,ExecToExitP50Us,ExecToExitP99Us,LdTotalUs,LdRelocUs,LdLoadUs,Relocations"
+RESULT_LINE="STARTUP_RESULT"
+
+# Launches per configuration (thousands, so p99 is stable).
+LAUNCHES=${LAUNCHES:-2000}
+
+# Drivers to compare: dynamic and static links of progA and progB.
+PROGRAMS=(${PROGRAMS:-progA progB progA.static progB.static})
+
+# CPUs the launcher and the drivers are pinned to (default: none).
+CPU_LIST=${CPU_LIST:-}
+
+# Launches one driver LAUNCHES times with a one-worker, zero-work run and
+# appends a CSV row. "quiet" drops the startup banner and per-worker lines.
+run_startup_benchmark() {
+    local program=$1
+    local output=$2
+    local link="dynamic"
+    if [[ "$program" == *.static ]]; then
+        link="static"
+    fi
+    local extra=""
+    if [[ "$output" == "quiet" ]]; then
+        extra="--quiet"
+    fi
+    local log="$LOG_DIR/startup_${program}_${output}.log"
+    local per_launch="$LOG_DIR/startup_${program}_${output}.csv"
+
+    echo -e "${CYAN}  Running: $program ($link, $output) x $LAUNCHES${NC}"
+
+    run_logged "$log" "$PROJECT_DIR/startup" "$per_launch" "$LAUNCHES" \
+        "$PROJECT_DIR/$program" idle 1 --idle-ms=0 $extra
+
+    local fields
+    fields=$(result_fields "$log" failed exec_to_main_us_p50 exec_to_main_us_p99 \
+             exec_to_first_worker_us_p50 exec_to_first_worker_us_p99 timer_init_us_p50 \
+             exec_to_first_worker_net_us_p50 exec_to_first_worker_net_us_p99 exec_to_exit_us_p50 \
+             exec_to_exit_us_p99 ld_total_us ld_reloc_us ld_load_us relocations)
+    append_row "$program,$link,$output,$LAUNCHES$fields"
+}
+
+main() {
+    print_banner "STARTUP LATENCY" \
+        "exec-to-main and exec-to-first-worker latency of" \
+        "dynamic vs static drivers, with and without output."
+
+    # Build the launcher and the static variants if they are missing.
+    if [[ ! -f "$PROJECT_DIR/startup" || ! -f "$PROJECT_DIR/progA.static" ]]; then
+        echo -e "${YELLOW}Building startup and the static drivers...${NC}"
+        make -C "$PROJECT_DIR" progA progB startup static > /dev/null
+    fi
+    require_programs "${PROGRAMS[@]}"
+
+    init_csv
+
+    for program in "${PROGRAMS[@]}"; do
+        for output in banner quiet; do
+            run_startup_benchmark "$program" "$output" || true
+        done
+    done
+
+    sweep_done "Startup latency sweep"
+    cat "$OUTPUT_CSV"
+}
+
+main "$@"
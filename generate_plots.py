@@ -6,6 +6,7 @@
 #   ├─ Y-axis: CPU Utilization (%)
 #   ├─ Line 1: progA (processes) - CPU% showing contention on one core.
 #   ├─ Line 2: progB (threads) - CPU% showing thread performance on one core.
+#   ├─ Line 3+: progO (OpenMP) - one line per OmpSchedule, only when the CSV has progO rows.
 #   └─ Insight: Shows how processes vs threads compete for a single CPU resource.
 #
 #   Plot 2: MT25081_mem_vs_components.png
@@ -36,12 +37,248 @@
 #   3. Intersecting lines = Crossover point where one model becomes more efficient.
 #
 
+# STREAMING AND INCREMENTAL REGENERATION:
+#   The CSV is never loaded whole. It is read in chunks of CHUNK_ROWS rows,
+#   only the columns the plots use, and each chunk is folded into running
+#   sums and counts per (Variant, Program, Worker_Type, Scale, OmpSchedule).
+#   Memory grows with the number of configurations, not rows; repeated rows
+#   of one configuration are averaged into one point.
+#
+#   The sums, the byte offset they cover and a SHA-256 of those bytes are
+#   kept in CACHE_FILE. A sweep rewrites the CSV from scratch (init_csv
+#   truncates it; cached configurations are written back first), so each
+#   run re-hashes the covered prefix: if it still matches, only the rows
+#   past it are parsed; if any byte changed, everything is read again.
+#
+#   Each plot is saved with a hash of its own input series. A plot is only
+#   redrawn when that hash changes or its PNG is missing.
+#
+# USAGE:
+#   python3 generate_plots.py            # redraw plots whose inputs changed
+#   python3 generate_plots.py --force    # re-read the CSV, redraw everything
+#
+
 # Import required libraries
 import pandas as pd                # For reading CSV and data manipulation
 import matplotlib.pyplot as plt    # For plotting and visualization
 import sys                         # For system exit on errors
 from pathlib import Path           # For file path operations
 import numpy as np                 # For numerical operations
+import hashlib                     # For input fingerprints and plot digests
+import json                        # For the aggregate/plot cache
+
+# Streamed input and its cache
+CSV_FILE = "MT25081_Part_D_CSV.csv"
+CACHE_FILE = "MT25081_plots_cache.json"
+CHUNK_ROWS = 100000
+
+# One plotted point per key; the metrics are averaged over its rows
+KEY_COLUMNS = ['Variant', 'Program', 'Worker_Type', 'Scale', 'OmpSchedule']
+REQUIRED_COLUMNS = ['Program', 'Worker_Type', 'Scale', 'AvgCPU_Percent',
+                    'AvgMemory_KB', 'TotalIO_KB', 'ExecutionTime_Sec']
+OPTIONAL_METRICS = ['PSI_CPU_Some_us', 'PssTotal_KB']
+
+# Read size for hashing the CSV
+HASH_BLOCK_BYTES = 1 << 20
+
+
+def data_end(path):
+    """
+    Returns the offset just past the last complete line, so a row that is
+    still being written is left for the next run.
+    """
+    with open(path, 'rb') as f:
+        end = f.seek(0, 2)
+        while end > 0:
+            start = max(0, end - 65536)
+            f.seek(start)
+            block = f.read(end - start)
+            newline = block.rfind(b'\n')
+            if newline >= 0:
+                return start + newline + 1
+            end = start
+    return 0
+
+
+def fingerprints(path, offset, end):
+    """
+    Returns the SHA-256 of bytes [0, offset) and of bytes [0, end), in one
+    pass over the file. Any change to the covered prefix changes the first.
+    """
+    digest = hashlib.sha256()
+    at_offset = None
+    position = 0
+    with open(path, 'rb') as f:
+        while position < end:
+            if position == offset:
+                at_offset = digest.hexdigest()
+            stop = end if position >= offset else min(offset, end)
+            block = f.read(min(HASH_BLOCK_BYTES, stop - position))
+            if not block:
+                break
+            digest.update(block)
+            position += len(block)
+    if at_offset is None and position == offset:
+        at_offset = digest.hexdigest()
+    return at_offset, digest.hexdigest()
+
+
+class BoundedReader:
+    """
+    File-like view of bytes [start, end) of a file, for pd.read_csv().
+    """
+    def __init__(self, f, start, end):
+        self.f = f
+        self.remaining = end - start
+        f.seek(start)
+
+    def read(self, size=-1):
+        if size < 0 or size > self.remaining:
+            size = self.remaining
+        data = self.f.read(size)
+        self.remaining -= len(data)
+        return data
+
+    def __iter__(self):
+        return iter(self.read().splitlines(keepends=True))
+
+
+def fold_chunk(sums, chunk, metrics):
+    """
+    Adds one chunk's per-key sums and non-null counts to the running totals.
+    """
+    if 'Variant' not in chunk.columns:
+        chunk = chunk.assign(Variant='base')
+    if 'OmpSchedule' not in chunk.columns:
+        chunk = chunk.assign(OmpSchedule='-')
+    grouped = chunk.groupby(KEY_COLUMNS)[metrics]
+    part = pd.concat([grouped.sum().add_prefix('sum_'),
+                      grouped.count().add_prefix('n_')], axis=1)
+    if sums is None:
+        return part
+    return pd.concat([sums, part]).groupby(level=KEY_COLUMNS).sum()
+
+
+def stream_aggregates(path, columns, start, end, sums):
+    """
+    Streams rows in bytes [start, end) of the CSV in CHUNK_ROWS chunks and
+    folds them into sums. Returns the updated sums and the rows read.
+    """
+    used = [c for c in columns if c in KEY_COLUMNS or c in REQUIRED_COLUMNS or
+            c in OPTIONAL_METRICS]
+    metrics = [c for c in used if c not in KEY_COLUMNS]
+    rows = 0
+    with open(path, 'rb') as f:
+        reader = pd.read_csv(BoundedReader(f, start, end), header=None, names=columns,
+                             usecols=used, chunksize=CHUNK_ROWS)
+        for chunk in reader:
+            sums = fold_chunk(sums, chunk, metrics)
+            rows += len(chunk)
+    return sums, rows
+
+
+def load_aggregates(path, cache, force):
+    """
+    Returns one row per (Variant, Program, Worker_Type, Scale, OmpSchedule)
+    with every metric averaged over its CSV rows, reading only what the
+    cache does not already cover. Updates cache['input'].
+    """
+    with open(path, 'rb') as f:
+        header = f.readline()
+    columns = header.decode().strip().split(',')
+    missing = [c for c in REQUIRED_COLUMNS if c not in columns]
+    if missing:
+        raise ValueError(f"CSV missing required columns: {missing}")
+
+    end = data_end(path)
+    cached = cache.get('input', {})
+    offset = cached.get('offset', 0)
+    sums = None
+    start = len(header)
+    if not len(header) <= offset <= end:
+        offset = 0
+    covered, current = fingerprints(path, offset, end)
+    resumed = (not force and cached.get('columns') == columns and
+               cached.get('keys') == KEY_COLUMNS and offset > 0 and
+               cached.get('fingerprint') == covered)
+    if resumed:
+        sums = pd.DataFrame.from_records(cached['sums'], index=KEY_COLUMNS)
+        start = offset
+
+    rows = 0
+    if end > start:
+        sums, rows = stream_aggregates(path, columns, start, end, sums)
+    if sums is None:
+        raise ValueError("CSV has no data rows")
+    print(f"  Read {rows} new rows ({end - start} bytes)"
+          f"{', resumed from cached aggregates' if resumed else ''}")
+
+    cache['input'] = {
+        'columns': columns,
+        'keys': KEY_COLUMNS,
+        'offset': end,
+        'fingerprint': current,
+        'sums': sums.reset_index().to_dict(orient='records'),
+    }
+
+    metrics = [c[len('sum_'):] for c in sums.columns if c.startswith('sum_')]
+    means = pd.DataFrame(index=sums.index)
+    for metric in metrics:
+        counts = sums['n_' + metric]
+        means[metric] = (sums['sum_' + metric] / counts).where(counts > 0)
+    return means.reset_index()
+
+
+def load_cache(force):
+    """
+    Reads CACHE_FILE; an empty cache if it is missing, unreadable or --force.
+    """
+    if force or not Path(CACHE_FILE).exists():
+        return {}
+    try:
+        with open(CACHE_FILE) as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+
+def save_cache(cache):
+    """
+    Writes CACHE_FILE atomically (a new file renamed over the old one).
+    """
+    tmp = CACHE_FILE + '.tmp'
+    with open(tmp, 'w') as f:
+        json.dump(cache, f)
+    Path(tmp).replace(CACHE_FILE)
+
+
+# Hash of this script: a change to how plots are drawn redraws all of them
+SCRIPT_HASH = hashlib.sha256(Path(__file__).read_bytes()).hexdigest()
+
+
+def plot_is_current(cache, png, inputs):
+    """
+    Whether png exists and was drawn from the same inputs by this script.
+    Otherwise records the new digest, to be saved once the plot is written.
+    """
+    data = inputs.sort_values(list(inputs.columns)).to_csv(index=False)
+    digest = hashlib.sha256((SCRIPT_HASH + data).encode()).hexdigest()
+    plots = cache.setdefault('plots', {})
+    if plots.get(png) == digest and Path(png).exists():
+        print(f"  Up to date: {png}")
+        return True
+    plots[png] = digest
+    return False
+
+def plot_omp(ax, data, column, label='Program O (OpenMP)', **style):
+    """
+    Plots one progO line per OmpSchedule in data; nothing without progO rows.
+    """
+    omp = data[data['Program'] == 'progO']
+    for (schedule, rows), marker in zip(omp.groupby('OmpSchedule'), '^vDP*'):
+        rows = rows.sort_values('Scale')
+        ax.plot(rows['Scale'], rows[column], marker=marker, color='#F18F01',
+                label=f'{label} {schedule}' if schedule != '-' else label, **style)
 
 def main():
     """
@@ -49,8 +286,8 @@ def main():
     """
     
     # ====== PHASE 1: FILE VALIDATION ======
-    # Define CSV filename
-    csv_file = "MT25081_Part_D_CSV.csv"
+    csv_file = CSV_FILE
+    force = '--force' in sys.argv[1:]
     
     # Check if CSV file exists before attempting to read
     if not Path(csv_file).exists():
@@ -58,24 +295,22 @@ def main():
         print("Please run Part D benchmark first: bash MT25081_Part_D_scaling.sh")
         sys.exit(1)
     
-    # ====== PHASE 2: READ CSV DATA ======
-    # Read CSV file into pandas DataFrame for easy manipulation
+    # ====== PHASE 2: STREAM CSV DATA ======
+    # Chunked read of the rows the cache does not cover (see STREAMING above)
     print("Reading benchmark data...")
+    cache = load_cache(force)
     try:
-        df = pd.read_csv(csv_file)
+        all_variants_df = load_aggregates(csv_file, cache, force)
     except Exception as e:
         print(f"Error reading CSV: {e}")
         sys.exit(1)
     
-    # Validate that required columns exist (updated for new format)
-    required_columns = ['Program', 'Worker_Type', 'Scale', 'AvgCPU_Percent', 
-                        'AvgMemory_KB', 'TotalIO_KB', 'ExecutionTime_Sec']
-    if not all(col in df.columns for col in required_columns):
-        print(f"Error: CSV missing required columns. Expected: {required_columns}")
-        sys.exit(1)
+    # Build variant sweeps (BINARY_VARIANTS) add a Variant column; the scaling
+    # plots use the base build and the variants get their own speedup plot
+    df = all_variants_df[all_variants_df['Variant'] == 'base']
     
     # Print data summary
-    print(f"  Loaded {len(df)} data rows")
+    print(f"  Aggregated {len(all_variants_df)} configurations")
     print(f"  Programs: {df['Program'].unique()}")
     print(f"  Worker types: {df['Worker_Type'].unique()}")
     print(f"  Scales: {sorted(df['Scale'].unique())}")
@@ -93,162 +328,273 @@ def main():
     #          when all processes/threads are pinned to a single core.
     #
     print("Generating performance analysis plots...")
+    if not plot_is_current(cache, 'MT25081_cpu_vs_components.png',
+                           df[df['Worker_Type'] == 'cpu'][['Program', 'OmpSchedule', 'Scale', 'AvgCPU_Percent']]):    
+        # Create figure and axis for plot 1
+        fig, ax = plt.subplots(figsize=fig_size)
     
-    # Create figure and axis for plot 1
-    fig, ax = plt.subplots(figsize=fig_size)
+        # Extract CPU worker data only
+        cpu_data = df[df['Worker_Type'] == 'cpu']
     
-    # Extract CPU worker data only
-    cpu_data = df[df['Worker_Type'] == 'cpu']
+        # Separate by program and sort by scale
+        progA_cpu = cpu_data[cpu_data['Program'] == 'progA'].sort_values('Scale')
+        progB_cpu = cpu_data[cpu_data['Program'] == 'progB'].sort_values('Scale')
     
-    # Separate by program and sort by scale
-    progA_cpu = cpu_data[cpu_data['Program'] == 'progA'].sort_values('Scale')
-    progB_cpu = cpu_data[cpu_data['Program'] == 'progB'].sort_values('Scale')
-    
-    # Plot line for progA (processes)
-    ax.plot(progA_cpu['Scale'], progA_cpu['AvgCPU_Percent'], 
-            marker='o', label='Program A (Processes)', 
-            linewidth=2.5, markersize=8, color='#2E86AB')
+        # Plot line for progA (processes)
+        ax.plot(progA_cpu['Scale'], progA_cpu['AvgCPU_Percent'], 
+                marker='o', label='Program A (Processes)', 
+                linewidth=2.5, markersize=8, color='#2E86AB')
     
-    # Plot line for progB (threads)
-    ax.plot(progB_cpu['Scale'], progB_cpu['AvgCPU_Percent'], 
-            marker='s', label='Program B (Threads)', 
-            linewidth=2.5, markersize=8, color='#A23B72')
+        # Plot line for progB (threads)
+        ax.plot(progB_cpu['Scale'], progB_cpu['AvgCPU_Percent'], 
+                marker='s', label='Program B (Threads)', 
+                linewidth=2.5, markersize=8, color='#A23B72')
+        plot_omp(ax, cpu_data, 'AvgCPU_Percent', linewidth=2.5, markersize=8)
     
-    # Configure axes labels and title
-    ax.set_xlabel('Scale (Count)', fontsize=12, fontweight='bold')
-    ax.set_ylabel('CPU Utilization (%)', fontsize=12, fontweight='bold')
-    ax.set_title('CPU Utilization vs Scale - CPU Worker', 
-                 fontsize=14, fontweight='bold')
+        # Configure axes labels and title
+        ax.set_xlabel('Scale (Count)', fontsize=12, fontweight='bold')
+        ax.set_ylabel('CPU Utilization (%)', fontsize=12, fontweight='bold')
+        ax.set_title('CPU Utilization vs Scale - CPU Worker', 
+                     fontsize=14, fontweight='bold')
     
-    # Add legend and grid
-    ax.legend(fontsize=11, loc='best')
-    ax.grid(True, alpha=0.3)
+        # Add legend and grid
+        ax.legend(fontsize=11, loc='best')
+        ax.grid(True, alpha=0.3)
     
-    # Save high-resolution PNG
-    plt.tight_layout()
-    plt.savefig('MT25081_cpu_vs_components.png', dpi=300, bbox_inches='tight')
-    print("  Generated: MT25081_cpu_vs_components.png")
-    plt.close()
+        # Save high-resolution PNG
+        plt.tight_layout()
+        plt.savefig('MT25081_cpu_vs_components.png', dpi=300, bbox_inches='tight')
+        print("  Generated: MT25081_cpu_vs_components.png")
+        plt.close()
     
     # ====== PHASE 5: PLOT 2 - MEMORY USAGE (MEMORY WORKER) ======
     # Purpose: Analyze how memory usage (in KB) scales for a memory-bound workload.
     #
     
-    fig, ax = plt.subplots(figsize=fig_size)
-    
-    # Extract memory worker data only
-    mem_data = df[df['Worker_Type'] == 'mem']
-    
-    # Separate by program and sort by scale
-    progA_mem = mem_data[mem_data['Program'] == 'progA'].sort_values('Scale')
-    progB_mem = mem_data[mem_data['Program'] == 'progB'].sort_values('Scale')
-    
-    # Plot lines using the new AvgMemory_KB column. This shows absolute memory usage.
-    ax.plot(progA_mem['Scale'], progA_mem['AvgMemory_KB'], 
-            marker='o', label='Program A (Processes)', 
-            linewidth=2.5, markersize=8, color='#2E86AB')
-    ax.plot(progB_mem['Scale'], progB_mem['AvgMemory_KB'], 
-            marker='s', label='Program B (Threads)', 
-            linewidth=2.5, markersize=8, color='#A23B72')
-    
-    # Configure axes with updated labels
-    ax.set_xlabel('Scale (Count)', fontsize=12, fontweight='bold')
-    ax.set_ylabel('Memory Usage (KB)', fontsize=12, fontweight='bold')
-    ax.set_title('Memory Usage vs Scale - Memory Worker', 
-                 fontsize=14, fontweight='bold')
-    ax.legend(fontsize=11, loc='best')
-    ax.grid(True, alpha=0.3)
-    
-    # Save
-    plt.tight_layout()
-    plt.savefig('MT25081_mem_vs_components.png', dpi=300, bbox_inches='tight')
-    print("  Generated: MT25081_mem_vs_components.png")
-    plt.close()
+    mem_columns = ['Program', 'OmpSchedule', 'Scale', 'AvgMemory_KB'] + (
+        ['PssTotal_KB'] if 'PssTotal_KB' in df.columns else [])
+    if not plot_is_current(cache, 'MT25081_mem_vs_components.png',
+                           df[df['Worker_Type'] == 'mem'][mem_columns]):
+        fig, ax = plt.subplots(figsize=fig_size)
+    
+        # Extract memory worker data only
+        mem_data = df[df['Worker_Type'] == 'mem']
+    
+        # Separate by program and sort by scale
+        progA_mem = mem_data[mem_data['Program'] == 'progA'].sort_values('Scale')
+        progB_mem = mem_data[mem_data['Program'] == 'progB'].sort_values('Scale')
+    
+        # Plot lines using the new AvgMemory_KB column. This shows absolute memory usage.
+        ax.plot(progA_mem['Scale'], progA_mem['AvgMemory_KB'], 
+                marker='o', label='Program A (Processes)', 
+                linewidth=2.5, markersize=8, color='#2E86AB')
+        ax.plot(progB_mem['Scale'], progB_mem['AvgMemory_KB'], 
+                marker='s', label='Program B (Threads)', 
+                linewidth=2.5, markersize=8, color='#A23B72')
+        plot_omp(ax, mem_data, 'AvgMemory_KB', linewidth=2.5, markersize=8)
+    
+        # PSS (--smaps) counts pages shared between progA's children once, so
+        # it is the fair process vs thread comparison; top RES double-counts them
+        # (the column is empty unless the sweep ran with SMAPS=1)
+        if 'PssTotal_KB' in df.columns and mem_data['PssTotal_KB'].notna().any():
+            ax.plot(progA_mem['Scale'], progA_mem['PssTotal_KB'], 
+                    marker='o', linestyle='--', label='Program A PSS', 
+                    linewidth=1.5, markersize=6, color='#2E86AB')
+            ax.plot(progB_mem['Scale'], progB_mem['PssTotal_KB'], 
+                    marker='s', linestyle='--', label='Program B PSS', 
+                    linewidth=1.5, markersize=6, color='#A23B72')
+    
+        # Configure axes with updated labels
+        ax.set_xlabel('Scale (Count)', fontsize=12, fontweight='bold')
+        ax.set_ylabel('Memory Usage (KB)', fontsize=12, fontweight='bold')
+        ax.set_title('Memory Usage vs Scale - Memory Worker', 
+                     fontsize=14, fontweight='bold')
+        ax.legend(fontsize=11, loc='best')
+        ax.grid(True, alpha=0.3)
+    
+        # Save
+        plt.tight_layout()
+        plt.savefig('MT25081_mem_vs_components.png', dpi=300, bbox_inches='tight')
+        print("  Generated: MT25081_mem_vs_components.png")
+        plt.close()
     
     # ====== PHASE 6: PLOT 3 - TOTAL I/O (I/O WORKER) ======
     # Purpose: Analyze how total I/O (in KB) scales for an I/O-bound workload.
     #
     
-    fig, ax = plt.subplots(figsize=fig_size)
-    
-    # Extract I/O worker data
-    io_data = df[df['Worker_Type'] == 'io']
-    
-    # Separate by program and sort by scale
-    progA_io = io_data[io_data['Program'] == 'progA'].sort_values('Scale')
-    progB_io = io_data[io_data['Program'] == 'progB'].sort_values('Scale')
-    
-    # Plot lines using the new TotalIO_KB column. This shows total kilobytes written.
-    ax.plot(progA_io['Scale'], progA_io['TotalIO_KB'], 
-            marker='o', label='Program A (Processes)', 
-            linewidth=2.5, markersize=8, color='#2E86AB')
-    ax.plot(progB_io['Scale'], progB_io['TotalIO_KB'], 
-            marker='s', label='Program B (Threads)', 
-            linewidth=2.5, markersize=8, color='#A23B72')
-    
-    # Configure axes with updated labels
-    ax.set_xlabel('Scale (Count)', fontsize=12, fontweight='bold')
-    ax.set_ylabel('Total I/O (KB)', fontsize=12, fontweight='bold')
-    ax.set_title('Total I/O vs Scale - I/O Worker', 
-                 fontsize=14, fontweight='bold')
-    ax.legend(fontsize=11, loc='best')
-    ax.grid(True, alpha=0.3)
-    
-    # Save
-    plt.tight_layout()
-    plt.savefig('MT25081_io_vs_components.png', dpi=300, bbox_inches='tight')
-    print("  Generated: MT25081_io_vs_components.png")
-    plt.close()
+    if not plot_is_current(cache, 'MT25081_io_vs_components.png',
+                           df[df['Worker_Type'] == 'io'][['Program', 'OmpSchedule', 'Scale', 'TotalIO_KB']]):
+        fig, ax = plt.subplots(figsize=fig_size)
+    
+        # Extract I/O worker data
+        io_data = df[df['Worker_Type'] == 'io']
+    
+        # Separate by program and sort by scale
+        progA_io = io_data[io_data['Program'] == 'progA'].sort_values('Scale')
+        progB_io = io_data[io_data['Program'] == 'progB'].sort_values('Scale')
+    
+        # Plot lines using the new TotalIO_KB column. This shows total kilobytes written.
+        ax.plot(progA_io['Scale'], progA_io['TotalIO_KB'], 
+                marker='o', label='Program A (Processes)', 
+                linewidth=2.5, markersize=8, color='#2E86AB')
+        ax.plot(progB_io['Scale'], progB_io['TotalIO_KB'], 
+                marker='s', label='Program B (Threads)', 
+                linewidth=2.5, markersize=8, color='#A23B72')
+        plot_omp(ax, io_data, 'TotalIO_KB', linewidth=2.5, markersize=8)
+    
+        # Configure axes with updated labels
+        ax.set_xlabel('Scale (Count)', fontsize=12, fontweight='bold')
+        ax.set_ylabel('Total I/O (KB)', fontsize=12, fontweight='bold')
+        ax.set_title('Total I/O vs Scale - I/O Worker', 
+                     fontsize=14, fontweight='bold')
+        ax.legend(fontsize=11, loc='best')
+        ax.grid(True, alpha=0.3)
+    
+        # Save
+        plt.tight_layout()
+        plt.savefig('MT25081_io_vs_components.png', dpi=300, bbox_inches='tight')
+        print("  Generated: MT25081_io_vs_components.png")
+        plt.close()
     
     # ====== PHASE 7: PLOT 4 - EXECUTION TIME (ALL WORKER TYPES) ======
     # Purpose: Compare execution time scaling for all three worker types.
     #
     
-    fig, axes = plt.subplots(1, 3, figsize=(18, 5))
+    if not plot_is_current(cache, 'MT25081_time_vs_components.png',
+                           df[['Program', 'OmpSchedule', 'Worker_Type', 'Scale', 'ExecutionTime_Sec']]):
+        fig, axes = plt.subplots(1, 3, figsize=(18, 5))
     
-    # Iterate through each worker type
-    for idx, worker in enumerate(['cpu', 'mem', 'io']):
-        ax = axes[idx]
+        # Iterate through each worker type
+        for idx, worker in enumerate(['cpu', 'mem', 'io']):
+            ax = axes[idx]
         
-        # Extract data for this worker type
-        progA_subset = df[(df['Program'] == 'progA') & 
-                          (df['Worker_Type'] == worker)].sort_values('Scale')
-        progB_subset = df[(df['Program'] == 'progB') & 
-                          (df['Worker_Type'] == worker)].sort_values('Scale')
+            # Extract data for this worker type
+            progA_subset = df[(df['Program'] == 'progA') & 
+                              (df['Worker_Type'] == worker)].sort_values('Scale')
+            progB_subset = df[(df['Program'] == 'progB') & 
+                              (df['Worker_Type'] == worker)].sort_values('Scale')
         
-        # Plot execution time for progA
-        ax.plot(progA_subset['Scale'], progA_subset['ExecutionTime_Sec'], 
-                marker='o', label='Processes', 
-                linewidth=2.5, markersize=8, color='#2E86AB')
+            # Plot execution time for progA
+            ax.plot(progA_subset['Scale'], progA_subset['ExecutionTime_Sec'], 
+                    marker='o', label='Processes', 
+                    linewidth=2.5, markersize=8, color='#2E86AB')
         
-        # Plot execution time for progB
-        ax.plot(progB_subset['Scale'], progB_subset['ExecutionTime_Sec'], 
-                marker='s', label='Threads', 
-                linewidth=2.5, markersize=8, color='#A23B72')
+            # Plot execution time for progB
+            ax.plot(progB_subset['Scale'], progB_subset['ExecutionTime_Sec'], 
+                    marker='s', label='Threads', 
+                    linewidth=2.5, markersize=8, color='#A23B72')
         
-        # Configure this subplot
-        ax.set_xlabel('Scale', fontsize=11, fontweight='bold')
-        ax.set_ylabel('Time (seconds)', fontsize=11, fontweight='bold')
-        ax.set_title(f'Execution Time - {worker.upper()} Worker', 
-                     fontsize=12, fontweight='bold')
-        ax.legend(fontsize=10, loc='best')
-        ax.grid(True, alpha=0.3)
-    
-    # Save all 3 subplots as single figure
-    plt.tight_layout()
-    plt.savefig('MT25081_time_vs_components.png', dpi=300, bbox_inches='tight')
-    print("  Generated: MT25081_time_vs_components.png")
-    plt.close()
+            # Plot execution time for progO (per schedule), when the CSV has it
+            plot_omp(ax, df[df['Worker_Type'] == worker], 'ExecutionTime_Sec', label='OpenMP',
+                     linewidth=2.5, markersize=8)
+        
+            # Configure this subplot
+            ax.set_xlabel('Scale', fontsize=11, fontweight='bold')
+            ax.set_ylabel('Time (seconds)', fontsize=11, fontweight='bold')
+            ax.set_title(f'Execution Time - {worker.upper()} Worker', 
+                         fontsize=12, fontweight='bold')
+            ax.legend(fontsize=10, loc='best')
+            ax.grid(True, alpha=0.3)
+    
+        # Save all 3 subplots as single figure
+        plt.tight_layout()
+        plt.savefig('MT25081_time_vs_components.png', dpi=300, bbox_inches='tight')
+        print("  Generated: MT25081_time_vs_components.png")
+        plt.close()
+    
+    # ====== PHASE 7b: PLOT 5 - CPU PRESSURE STALL (ALL WORKER TYPES) ======
+    # Purpose: Show whether the time growth on a single core is explained by
+    #          CPU pressure (PSI "some" stall time). Only for CSVs recorded
+    #          with the PSI columns (MT25081_Part_C_psi.sh).
+    #
+    if 'PSI_CPU_Some_us' in df.columns and not plot_is_current(
+            cache, 'MT25081_psi_vs_components.png',
+            df[['Program', 'Worker_Type', 'Scale', 'PSI_CPU_Some_us']]):
+        fig, axes = plt.subplots(1, 3, figsize=(18, 5))
+        
+        for idx, worker in enumerate(['cpu', 'mem', 'io']):
+            ax = axes[idx]
+            progA_subset = df[(df['Program'] == 'progA') & 
+                              (df['Worker_Type'] == worker)].sort_values('Scale')
+            progB_subset = df[(df['Program'] == 'progB') & 
+                              (df['Worker_Type'] == worker)].sort_values('Scale')
+            
+            # Stall microseconds -> seconds, comparable with ExecutionTime_Sec
+            ax.plot(progA_subset['Scale'], progA_subset['PSI_CPU_Some_us'] / 1e6, 
+                    marker='o', label='Processes', 
+                    linewidth=2.5, markersize=8, color='#2E86AB')
+            ax.plot(progB_subset['Scale'], progB_subset['PSI_CPU_Some_us'] / 1e6, 
+                    marker='s', label='Threads', 
+                    linewidth=2.5, markersize=8, color='#A23B72')
+            
+            ax.set_xlabel('Scale', fontsize=11, fontweight='bold')
+            ax.set_ylabel('CPU Stall "some" (seconds)', fontsize=11, fontweight='bold')
+            ax.set_title(f'CPU Pressure - {worker.upper()} Worker', 
+                         fontsize=12, fontweight='bold')
+            ax.legend(fontsize=10, loc='best')
+            ax.grid(True, alpha=0.3)
+        
+        plt.tight_layout()
+        plt.savefig('MT25081_psi_vs_components.png', dpi=300, bbox_inches='tight')
+        print("  Generated: MT25081_psi_vs_components.png")
+        plt.close()
+    
+    # ====== PHASE 7c: PLOT 6 - BUILD VARIANT SPEEDUP ======
+    # Purpose: Quantify compiler-driven speedups (native, lto, pgo) per worker.
+    #          Speedup = base time / variant time, averaged over all scales.
+    #
+    has_variants = ('Variant' in all_variants_df.columns and
+                    all_variants_df['Variant'].nunique() > 1)
+    if has_variants and not plot_is_current(
+            cache, 'MT25081_variant_speedup.png',
+            all_variants_df[KEY_COLUMNS + ['ExecutionTime_Sec']]):
+        base_times = df.set_index(['Program', 'Worker_Type', 'Scale'])['ExecutionTime_Sec']
+        variants = [v for v in all_variants_df['Variant'].unique() if v != 'base']
+        
+        fig, axes = plt.subplots(1, 2, figsize=(16, 6))
+        for idx, program in enumerate(['progA', 'progB']):
+            ax = axes[idx]
+            width = 0.8 / len(variants)
+            for v_idx, variant in enumerate(variants):
+                speedups = []
+                for worker in ['cpu', 'mem', 'io']:
+                    subset = all_variants_df[(all_variants_df['Program'] == program) &
+                                             (all_variants_df['Worker_Type'] == worker) &
+                                             (all_variants_df['Variant'] == variant)]
+                    ratios = [base_times.get((program, worker, row.Scale), np.nan) /
+                              row.ExecutionTime_Sec for row in subset.itertuples()]
+                    speedups.append(np.nanmean(ratios) if ratios else np.nan)
+                ax.bar(np.arange(3) + v_idx * width, speedups, width, label=variant)
+            
+            ax.axhline(1.0, color='black', linewidth=1, linestyle='--')
+            ax.set_xticks(np.arange(3) + 0.4 - width / 2)
+            ax.set_xticklabels(['CPU', 'MEM', 'IO'])
+            ax.set_ylabel('Speedup vs base build (x)', fontsize=11, fontweight='bold')
+            ax.set_title(f'Build Variant Speedup - {program}', 
+                         fontsize=12, fontweight='bold')
+            ax.legend(fontsize=10, loc='best')
+            ax.grid(True, alpha=0.3)
+        
+        plt.tight_layout()
+        plt.savefig('MT25081_variant_speedup.png', dpi=300, bbox_inches='tight')
+        print("  Generated: MT25081_variant_speedup.png")
+        plt.close()
     
     # ====== PHASE 8: COMPLETION MESSAGE ======
+    # Aggregates and plot digests, for the next incremental run
+    save_cache(cache)
     print("")
-    print("All 4 plots generated successfully!")
+    print("All plots are up to date!")
     print("")
     print("Plot Files:")
     print("  1. MT25081_cpu_vs_components.png  (CPU utilization scaling)")
     print("  2. MT25081_mem_vs_components.png  (Memory usage scaling)")
     print("  3. MT25081_io_vs_components.png   (Total I/O scaling)")
     print("  4. MT25081_time_vs_components.png (Execution time comparison)")
+    if 'PSI_CPU_Some_us' in df.columns:
+        print("  5. MT25081_psi_vs_components.png  (CPU pressure stall time)")
+    if has_variants:
+        print("  6. MT25081_variant_speedup.png     (Build variant speedup)")
     print("")
     print("Next Steps:")
     print("  1. Open plots to verify data visualization")
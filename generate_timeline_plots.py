@@ -0,0 +1,102 @@
+# TIMELINE PLOTS:
+#
+#   Time-series plots for the per-run timelines recorded by ./timeline
+#   (MT25081_Part_C_timeline.c). One PNG per timeline CSV, next to the CSV:
+#
+#   logs/timeline_<program>_<worker>_<scale>.csv -> .png
+#   ├─ Subplot 1: CPU utilization (%) per worker (d(utime+stime)/dt)
+#   ├─ Subplot 2: Resident memory (MB) of each worker's process
+#   ├─ Subplot 3: I/O throughput (MB/s) per worker (wchar + rchar rate)
+#   └─ Subplot 4: Context switches per second per worker (vol + invol)
+#
+#   A progA worker is one process (pid); a progB worker is one thread (tid).
+#   Phase behavior (mem_worker's first-touch RSS ramp, io_worker's fsync
+#   stalls) shows up here instead of being averaged into one CSV row.
+#
+# USAGE:
+#   python3 generate_timeline_plots.py                 # all logs/timeline_*.csv
+#   python3 generate_timeline_plots.py run1.csv ...    # specific timelines
+#
+
+# Import required libraries
+import pandas as pd                # For reading CSV and data manipulation
+import matplotlib.pyplot as plt    # For plotting and visualization
+import sys                         # For command-line arguments
+from pathlib import Path           # For file path operations
+
+# Columns written by the timeline recorder
+REQUIRED_COLUMNS = ['t_ms', 'pid', 'tid', 'utime_ms', 'stime_ms', 'rss_kb',
+                    'rchar', 'wchar', 'vol_ctx', 'invol_ctx']
+
+
+def worker_rates(task):
+    """
+    Converts one task's cumulative counters into per-interval rates.
+    """
+    task = task.sort_values('t_ms')
+    dt = task['t_ms'].diff() / 1000.0
+    cpu_ms = task['utime_ms'] + task['stime_ms']
+    return pd.DataFrame({
+        't_s': task['t_ms'] / 1000.0,
+        'cpu_pct': cpu_ms.diff() / 1000.0 / dt * 100.0,
+        'rss_mb': task['rss_kb'] / 1024.0,
+        'io_mbps': (task['rchar'] + task['wchar']).diff() / dt / (1024.0 * 1024.0),
+        'ctx_per_s': (task['vol_ctx'] + task['invol_ctx']).diff() / dt,
+    }).dropna()
+
+
+def plot_timeline(csv_file):
+    """
+    Generates the 4-panel time-series PNG for one timeline CSV.
+    """
+    df = pd.read_csv(csv_file)
+    if not all(col in df.columns for col in REQUIRED_COLUMNS):
+        print(f"  Skipping {csv_file}: not a timeline CSV")
+        return
+
+    fig, axes = plt.subplots(4, 1, figsize=(14, 12), sharex=True)
+    panels = [('cpu_pct', 'CPU (%)'), ('rss_mb', 'RSS (MB)'),
+              ('io_mbps', 'I/O (MB/s)'), ('ctx_per_s', 'Ctx switches/s')]
+
+    # One line per task; the idle progB main thread / progA parent stay flat
+    for (pid, tid), task in df.groupby(['pid', 'tid']):
+        if len(task) < 2:
+            continue
+        rates = worker_rates(task)
+        label = f'pid {pid}' if pid == tid else f'tid {tid}'
+        for ax, (column, _) in zip(axes, panels):
+            ax.plot(rates['t_s'], rates[column], linewidth=1.2, label=label)
+
+    for ax, (_, ylabel) in zip(axes, panels):
+        ax.set_ylabel(ylabel, fontsize=11, fontweight='bold')
+        ax.grid(True, alpha=0.3)
+    axes[0].set_title(f'Resource Timeline - {Path(csv_file).stem}',
+                      fontsize=14, fontweight='bold')
+    axes[0].legend(fontsize=8, loc='upper right', ncol=4)
+    axes[-1].set_xlabel('Time (s)', fontsize=12, fontweight='bold')
+
+    out_file = Path(csv_file).with_suffix('.png')
+    plt.tight_layout()
+    plt.savefig(out_file, dpi=150, bbox_inches='tight')
+    plt.close()
+    print(f"  Generated: {out_file}")
+
+
+def main():
+    """
+    Plots every timeline given on the command line (or found in logs/).
+    """
+    files = sys.argv[1:] or sorted(str(p) for p in Path('logs').glob('timeline_*.csv'))
+    if not files:
+        print("Error: no timeline CSVs found")
+        print("Record some first: TIMELINE_INTERVAL_MS=20 bash MT25081_Part_D_scaling.sh")
+        sys.exit(1)
+
+    plt.style.use('seaborn-v0_8-darkgrid')
+    print(f"Generating {len(files)} timeline plot(s)...")
+    for csv_file in files:
+        plot_timeline(csv_file)
+
+
+if __name__ == '__main__':
+    main()